@@ -1,5 +1,4 @@
 #include <iostream>
-#include <sstream>
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
@@ -7,12 +6,15 @@
 #include <string>
 #include <algorithm>
 #include <set>
+#include "graph_parser.h"
+#include "line_stream.h"
+#include "output_buffer.h"
 
 using namespace std;
 
-void handleVertexCommand(string &line, int &vertexCount, vector<pair<int, int>> &edges, unordered_map<int, vector<int>> &adjacencyList);
-void handleEdgeCommand(string &line, int vertexCount, vector<pair<int, int>> &edges, unordered_map<int, vector<int>> &adjacencyList);
-void handleShortestPathCommand(string &line, int vertexCount, const unordered_map<int, vector<int>> &adjacencyList);
+void handleVertexCommand(CommandScanner &input, int &vertexCount, vector<pair<int, int>> &edges, unordered_map<int, vector<int>> &adjacencyList);
+void handleEdgeCommand(CommandScanner &input, int vertexCount, vector<pair<int, int>> &edges, unordered_map<int, vector<int>> &adjacencyList);
+void handleShortestPathCommand(CommandScanner &input, int vertexCount, const unordered_map<int, vector<int>> &adjacencyList);
 std::vector<int> findShortestPathBFS(const unordered_map<int, vector<int>> &adjacencyList, int start, int end);
 void printPathResult(const vector<int> &path);
 
@@ -21,27 +23,27 @@ int main(int argc, char** argv) {
     std::unordered_map<int, vector<int>> adjacencyList; 
     int vertexCount = 0;
 
-    while (!std::cin.eof()) {
-        std::string line;
-        std::getline(std::cin, line);
-
-        if (line.empty()) {
+    // Lines are parsed straight off a fixed-size read buffer
+    StreamLineReader lines(0);
+    while (lines.nextLine()) {
+        CommandScanner input(lines);
+        char first = '\0';
+        if (!input.peekRawChar(first)) {
             continue;
         }
 
-        std::istringstream input(line);
-        char c;
-        input >> c;
+        char c = '\0';
+        input.readChar(c);
 
         switch (c) {
             case 'V':
-                handleVertexCommand(line, vertexCount, edges, adjacencyList);
+                handleVertexCommand(input, vertexCount, edges, adjacencyList);
                 break;
             case 'E':
-                handleEdgeCommand(line, vertexCount, edges, adjacencyList);
+                handleEdgeCommand(input, vertexCount, edges, adjacencyList);
                 break;
             case 's':
-                handleShortestPathCommand(line, vertexCount, adjacencyList);
+                handleShortestPathCommand(input, vertexCount, adjacencyList);
                 break;
             default:
                 std::cout << "Error: Unrecognized command. Valid commands are 'V', 'E', or 's'.\n";
@@ -52,12 +54,8 @@ int main(int argc, char** argv) {
     return 0;
 }
 
-void handleVertexCommand(string &line, int &vertexCount, vector<pair<int, int>> &edges, unordered_map<int, vector<int>> &adjacencyList) {
-    std::istringstream input(line);
-    char c;
-    input >> c;
-
-    input >> vertexCount;
+void handleVertexCommand(CommandScanner &input, int &vertexCount, vector<pair<int, int>> &edges, unordered_map<int, vector<int>> &adjacencyList) {
+    input.readInt(vertexCount);
     if (input.fail() || vertexCount <= 1) {
         std::cout << "Error: Invalid number of vertices. The vertex count must be greater than 1.\n";
         exit(0);
@@ -67,81 +65,49 @@ void handleVertexCommand(string &line, int &vertexCount, vector<pair<int, int>>
     adjacencyList.clear();
 }
 
-void handleEdgeCommand(string &line, int vertexCount, vector<pair<int, int>> &edges, unordered_map<int, vector<int>> &adjacencyList) {
+void handleEdgeCommand(CommandScanner &input, int vertexCount, vector<pair<int, int>> &edges, unordered_map<int, vector<int>> &adjacencyList) {
     if (vertexCount == 0) {
         std::cout << "Error: Define vertices first using the 'V' command before adding edges.\n";
         exit(0);
     }
 
-    std::istringstream input(line);
-    char c, edgeStart;
-    input >> c >> edgeStart;
-
-    if (edgeStart != '{') {
-        std::cout << "Error: Edges should start with '{'.\n";
-        exit(0);
-    }
-
     edges.clear();
     std::set<pair<int, int>> uniqueEdges;  
 
-    char nextChar;
-    input >> nextChar;
-
-    if (nextChar == '}') {
-        adjacencyList.clear();
-        return; 
-    } else {
-        input.putback(nextChar); 
-    }
-
-    while (!input.eof()) {
-        char bracketStart, comma, bracketEnd;
-        int v1, v2;
-
-        input >> bracketStart;
-        if (bracketStart == '}') {
-            break; 
+    auto addEdge = [&](int v1, int v2) {
+        pair<int, int> edge = {min(v1, v2), max(v1, v2)};
+        if (!uniqueEdges.insert(edge).second) {
+            return false;
         }
-        if (bracketStart != '<') {  
+        edges.emplace_back(edge);
+        return true;
+    };
+    EdgeListResult result = parseEdgeList(input, vertexCount, true, addEdge);
+
+    switch (result.error) {
+        case EDGE_LIST_OK:
+            break;
+        case EDGE_LIST_BAD_OPEN:
+            std::cout << "Error: Edges should start with '{'.\n";
+            exit(0);
+        case EDGE_BAD_OPEN:
             std::cout << "Error: Each edge should start with '<'.\n";
             exit(0);
-        }
-
-        input >> v1 >> comma >> v2 >> bracketEnd;
-
-        if (comma != ',' || bracketEnd != '>') {
+        case EDGE_BAD_FORMAT:
             std::cout << "Error: Invalid edge format. Expected format is <v1,v2>.\n";
             exit(0);
-        }
-
-        if (!(v1 >= 1 && v1 <= vertexCount && v2 >= 1 && v2 <= vertexCount) || v1 == v2) {
-            std::cout << "Error: Invalid edge (" << v1 << "," << v2 << "). Ensure vertices are within range and no self-loops exist.\n";
+        case EDGE_OUT_OF_RANGE:
+            std::cout << "Error: Invalid edge (" << result.first << "," << result.second << "). Ensure vertices are within range and no self-loops exist.\n";
             exit(0);
-        }
-
-        pair<int, int> edge = {min(v1, v2), max(v1, v2)};
-        if (uniqueEdges.find(edge) != uniqueEdges.end()) {  
-            std::cout << "Error: Duplicate undirected edge detected (" << v1 << "," << v2 << ").\n";
-            exit(0);  
-        }
-
-        uniqueEdges.insert(edge);
-        edges.emplace_back(edge);
-
-        input >> nextChar;
-        if (nextChar == '}') {
-            break;
-        }
-        if (nextChar != ',') {  
+        case EDGE_DUPLICATE:
+            std::cout << "Error: Duplicate undirected edge detected (" << result.first << "," << result.second << ").\n";
+            exit(0);
+        case EDGE_BAD_SEPARATOR:
             std::cout << "Error: Edges should be separated by commas.\n";
             exit(0);
-        }
-    }
-
-    if (nextChar != '}') {
-        std::cout << "Error: Edge list should end with '}'.\n";
-        exit(0);
+        case EDGE_LIST_BAD_CLOSE:
+            std::cout << "Error: Edge list should end with '}'.\n";
+            exit(0);
     }
 
     adjacencyList.clear();
@@ -152,16 +118,16 @@ void handleEdgeCommand(string &line, int vertexCount, vector<pair<int, int>> &ed
 }
 
 
-void handleShortestPathCommand(string &line, int vertexCount, const unordered_map<int, vector<int>> &adjacencyList) {
+void handleShortestPathCommand(CommandScanner &input, int vertexCount, const unordered_map<int, vector<int>> &adjacencyList) {
     if (vertexCount == 0 || adjacencyList.empty()) {
         std::cout << "Error: No graph defined. Use 'V' and 'E' commands to create a graph first.\n";
         exit(0);
     }
 
-    std::istringstream input(line);
-    char c;
-    int source, destination;
-    input >> c >> source >> destination;
+    int source = 0;
+    int destination = 0;
+    input.readInt(source);
+    input.readInt(destination);
 
     if (input.fail()) {
         std::cout << "Error: Invalid format for shortest path command. Use: s <source> <destination>\n";
@@ -213,12 +179,15 @@ void printPathResult(const vector<int> &path) {
         std::cout << "Error: No path exists between the specified vertices.\n";
         exit(0);
     } else {
+        // Reused for every path; drained right away so error messages stay in order
+        static OutputBuffer output;
         for (size_t i = 0; i < path.size(); ++i) {
-            std::cout << path[i];
+            output.putInt(path[i]);
             if (i < path.size() - 1) {
-                std::cout << "-";  
+                output.put('-');
             }
         }
-        std::cout << "\n";
+        output.put('\n');
+        output.drain();
     }
 }
\ No newline at end of file
@@ -1,11 +1,12 @@
 #include <iostream>
-#include <sstream>
 #include <vector>
 #include <set>
 #include <unordered_set>
 #include <unordered_map>
 #include <queue>
 #include <list>
+#include <algorithm>
+#include "graph_parser.h"
 
 std::vector<int> findShortestPath(const std::unordered_map<int, std::list<int>>& graphAdjList, 
                                  const std::set<int>& graphVertices, 
@@ -20,6 +21,8 @@ int main(int argc, char** argv) {
     std::set<int> graphVertices;
     std::unordered_map<int, std::list<int>> graphAdjList;
     bool isEmptyGraph = false;
+    // The edge reader's variables keep their values from one line to the next
+    EdgeReadState edgeState = {'\0', 0, '\0', 0, '\0'};
       
     while (!std::cin.eof()) {
         std::string inputLine;
@@ -33,15 +36,15 @@ int main(int argc, char** argv) {
             continue;
         }
 
-        std::istringstream inputStream(inputLine);
-        char cmd;
-        inputStream >> cmd;
+        CommandScanner inputStream(inputLine.data(), inputLine.data() + inputLine.size());
+        char cmd = '\0';
+        inputStream.readChar(cmd);
 
         if (cmd == 'V'){
             bool isValidInput = true;
 
             while(!inputStream.eof()){
-                inputStream >> vertexCount;
+                inputStream.readInt(vertexCount);
                 if (inputStream.fail()) {
                     isValidInput = false;
                     break;
@@ -77,53 +80,18 @@ int main(int argc, char** argv) {
                 continue;
             }
 
-            char bracketStart;
-            inputStream >> bracketStart;
-
-            bool hasError = false;
-            bool hasDuplicateEdge = false;
-
-            while(!inputStream.eof()){
-                char pairStart;
-                inputStream >> pairStart;
-
-                if(pairStart == '}'){
-                    isEmptyGraph = true;
-                    break;
-                }
-
-                int vertex1, vertex2;
-                char delimiter, pairEnd;
-                inputStream >> vertex1;
-                inputStream >> delimiter;
-                inputStream >> vertex2;
-                inputStream >> pairEnd;
-                       
-                if (vertex1 < 1 || vertex1 > vertexCount || 
-                    vertex2 < 1 || vertex2 > vertexCount || 
-                    vertex1 == vertex2){
-                    hasError = true;
-                    break;
-                }
-            
-                // Check for duplicate edges
-                if(!edgeList.empty()){
-                    for (const auto& edge : edgeList) {
-                        if(edge.first == vertex1 && edge.second == vertex2){
-                            hasDuplicateEdge = true;
-                        }
-                    }
-                }
-
+            // Every edge is kept, a repeat in either direction only marks the input
+            std::set<std::pair<int, int>> seenEdges;
+            auto addEdge = [&](int vertex1, int vertex2) {
                 edgeList.emplace_back(vertex1, vertex2);
-
-                char nextChar;
-                inputStream >> nextChar;
-
-                if (nextChar == '}'){
-                    break;
-                }
+                return seenEdges.insert(std::make_pair(std::min(vertex1, vertex2), std::max(vertex1, vertex2))).second;
+            };
+            EdgeListResult edges = parseEdgeList(inputStream, vertexCount, false, addEdge, edgeState);
+            if (edges.closedEarly){
+                isEmptyGraph = true;
             }
+            bool hasError = edges.error != EDGE_LIST_OK;
+            bool hasDuplicateEdge = edges.duplicate;
 
             if (hasError){
                 edgeList.clear();
@@ -132,17 +100,6 @@ int main(int argc, char** argv) {
                 continue;
             }
 
-            // Check for bidirectional duplicate edges
-            if(edgeList.size() > 1){
-                for (const auto& edge1 : edgeList) {
-                    for(const auto& edge2 : edgeList){
-                        if(edge1.first == edge2.second && edge1.second == edge2.first){
-                            hasDuplicateEdge = true;
-                        }
-                    }
-                }
-            }
-
             if (hasDuplicateEdge){
                 edgeList.clear();
                 vertexCount = 0;
@@ -175,16 +132,16 @@ int main(int argc, char** argv) {
                 continue;
             }
 
-            int startVertex;
-            inputStream >> startVertex;
+            int startVertex = 0;
+            inputStream.readInt(startVertex);
             if (inputStream.fail()) {
                 std::cerr << "Error: Invalid format of command \n";
                 isEmptyGraph = false;
                 continue;
             }
 
-            int endVertex;
-            inputStream >> endVertex;
+            int endVertex = 0;
+            inputStream.readInt(endVertex);
             if (inputStream.fail()) {
                 std::cerr << "Error: Invalid format of command \n";
                 isEmptyGraph = false;
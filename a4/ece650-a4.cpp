@@ -1,5 +1,4 @@
 #include <iostream>
-#include <sstream>
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
@@ -8,17 +7,68 @@
 #include <algorithm>
 #include <set>
 #include <memory>
+#include "graph_parser.h"
+#include "output_buffer.h"
 #include "minisat/core/Solver.h"
 #include "minisat/core/SolverTypes.h"
 
 using namespace Minisat;
 using namespace std;
 
-void handleVertexCommand(string &line, int &vertexCount, vector<pair<int, int>> &edges, unordered_map<int, vector<int>> &adjacencyList);
-void handleEdgeCommand(string &line, int vertexCount, vector<pair<int, int>> &edges, unordered_map<int, vector<int>> &adjacencyList);
+void handleVertexCommand(CommandScanner &input, int &vertexCount, vector<pair<int, int>> &edges, unordered_map<int, vector<int>> &adjacencyList);
+void handleEdgeCommand(CommandScanner &input, int vertexCount, vector<pair<int, int>> &edges, unordered_map<int, vector<int>> &adjacencyList);
 void findVertexCover(int v, vector<pair<int, int>> &edges);
+bool solveVertexCoverForK(int v, const vector<pair<int, int>> &edges, int k, vector<int> &cover);
+bool solvePositionCoverForK(int v, const vector<pair<int, int>> &edges, int k, vector<int> &cover);
+bool solveCounterCoverForK(int v, const vector<pair<int, int>> &edges, int k, vector<int> &cover);
+
+// Order in which cover sizes k are handed to the solver
+enum SearchStrategy { SEARCH_LINEAR, SEARCH_BINARY, SEARCH_GALLOPING };
+SearchStrategy searchStrategy = SEARCH_LINEAR;
+
+// CNF for "the cover has k vertices": v x k positions, or one variable per
+// vertex with a sequential-counter at-most-k constraint
+enum Encoding { ENCODING_POSITION, ENCODING_SEQUENTIAL_COUNTER };
+Encoding encoding = ENCODING_POSITION;
+
+// Position encoding only: force the vertices into increasing order along the
+// positions, so only one of the k! equivalent orderings of a cover remains
+bool breakSymmetry = false;
+
+int main(int argc, char **argv) {
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        if (arg == "--search" && i + 1 < argc) {
+            string search = argv[++i];
+            if (search == "linear") {
+                searchStrategy = SEARCH_LINEAR;
+            } else if (search == "binary") {
+                searchStrategy = SEARCH_BINARY;
+            } else if (search == "galloping") {
+                searchStrategy = SEARCH_GALLOPING;
+            } else {
+                cerr << "Error: Unknown search strategy " << search << "\n";
+                return 1;
+            }
+        } else if (arg == "--encoding" && i + 1 < argc) {
+            string name = argv[++i];
+            if (name == "position") {
+                encoding = ENCODING_POSITION;
+            } else if (name == "seqcounter") {
+                encoding = ENCODING_SEQUENTIAL_COUNTER;
+            } else {
+                cerr << "Error: Unknown encoding " << name << "\n";
+                return 1;
+            }
+        } else if (arg == "--symmetry-breaking") {
+            breakSymmetry = true;
+        } else {
+            cerr << "Error: Unknown option " << arg << "\n";
+            return 1;
+        }
+    }
+
 
-int main() {
     vector<pair<int, int>> edges;                  
     unordered_map<int, vector<int>> adjacencyList; 
     int vertexCount = 0;
@@ -31,16 +81,16 @@ int main() {
             continue;
         }
 
-        istringstream input(line);
-        char c;
-        input >> c;
+        CommandScanner input(line.data(), line.data() + line.size());
+        char c = '\0';
+        input.readChar(c);
 
         switch (c) {
             case 'V':
-                handleVertexCommand(line, vertexCount, edges, adjacencyList);
+                handleVertexCommand(input, vertexCount, edges, adjacencyList);
                 break;
             case 'E':
-                handleEdgeCommand(line, vertexCount, edges, adjacencyList);
+                handleEdgeCommand(input, vertexCount, edges, adjacencyList);
                 if (!edges.empty() ) {
                     findVertexCover(vertexCount, edges);
                 }
@@ -54,11 +104,8 @@ int main() {
     return 0;
 }
 
-void handleVertexCommand(string &line, int &vertexCount, vector<pair<int, int>> &edges, unordered_map<int, vector<int>> &adjacencyList) {
-    istringstream input(line);
-    char c;
-    input >> c;
-    input >> vertexCount;
+void handleVertexCommand(CommandScanner &input, int &vertexCount, vector<pair<int, int>> &edges, unordered_map<int, vector<int>> &adjacencyList) {
+    input.readInt(vertexCount);
     if (input.fail() || vertexCount <= 1) {
         cout << "Error: Invalid number of vertices. The vertex count must be greater than 1.\n";
         return;
@@ -68,80 +115,52 @@ void handleVertexCommand(string &line, int &vertexCount, vector<pair<int, int>>
     adjacencyList.clear();
 }
 
-void handleEdgeCommand(string &line, int vertexCount, vector<pair<int, int>> &edges, unordered_map<int, vector<int>> &adjacencyList) {
+void handleEdgeCommand(CommandScanner &input, int vertexCount, vector<pair<int, int>> &edges, unordered_map<int, vector<int>> &adjacencyList) {
     if (vertexCount == 0) {
         cout << "Error: Define vertices first using the 'V' command before adding edges.\n";
         return;
     }
 
-    istringstream input(line);
-    char c, edgeStart;
-    input >> c >> edgeStart;
-
-    if (edgeStart != '{') {
-        cout << "Error: Edges should start with '{'.\n";
-        return;
-    }
-
-    edges.clear();
+    // A list that does not open with '{' leaves the previous edges in place
+    vector<pair<int, int>> previous;
+    previous.swap(edges);
     set<pair<int, int>> uniqueEdges;  
 
-    char nextChar;
-    input >> nextChar;
-
-    if (nextChar == '}') {
-        adjacencyList.clear();
-        return; 
-    } else {
-        input.putback(nextChar); 
-    }
-
-    while (!input.eof()) {
-        char bracketStart, comma, bracketEnd;
-        int v1, v2;
-
-        input >> bracketStart;
-        if (bracketStart == '}') {
-            break; 
+    auto addEdge = [&](int v1, int v2) {
+        pair<int, int> edge = {min(v1, v2), max(v1, v2)};
+        if (!uniqueEdges.insert(edge).second) {
+            return false;
         }
-        if (bracketStart != '<') {  
+        edges.emplace_back(edge);
+        return true;
+    };
+    EdgeListResult result = parseEdgeList(input, vertexCount, true, addEdge);
+
+    switch (result.error) {
+        case EDGE_LIST_OK:
+            break;
+        case EDGE_LIST_BAD_OPEN:
+            edges.swap(previous);
+            cout << "Error: Edges should start with '{'.\n";
+            return;
+        case EDGE_BAD_OPEN:
             cout << "Error: Each edge should start with '<'.\n";
             return;
-        }
-
-        input >> v1 >> comma >> v2 >> bracketEnd;
-
-        if (comma != ',' || bracketEnd != '>') {
+        case EDGE_BAD_FORMAT:
             cout << "Error: Invalid edge format. Expected format is <v1,v2>.\n";
             return;
-        }
-
-        if (!(v1 >= 1 && v1 <= vertexCount && v2 >= 1 && v2 <= vertexCount) || v1 == v2) {
-            cout << "Error: Invalid edge (" << v1 << "," << v2 << "). Ensure vertices are within range and no self-loops exist.\n";
+        case EDGE_OUT_OF_RANGE:
+            cout << "Error: Invalid edge (" << result.first << "," << result.second << "). Ensure vertices are within range and no self-loops exist.\n";
             return;
-        }
-
-        pair<int, int> edge = {min(v1, v2), max(v1, v2)};
-        if (uniqueEdges.find(edge) != uniqueEdges.end()) {  
-            cout << "Error: Duplicate undirected edge detected (" << v1 << "," << v2 << ").\n";
-            return;  
-        }
-
-        uniqueEdges.insert(edge);
-        edges.emplace_back(edge);
-
-        input >> nextChar;
-        if (nextChar == '}') {
-            break;
-        }
-        if (nextChar != ',') {  
+        case EDGE_DUPLICATE:
+            cout << "Error: Duplicate undirected edge detected (" << result.first << "," << result.second << ").\n";
+            return;
+        case EDGE_BAD_SEPARATOR:
             cout << "Error: Edges should be separated by commas.\n";
             return;
-        }
-    }
-
-    if (nextChar != '}') {
-        cout << "Error: Edge list should end with '}'.\n";
+        case EDGE_LIST_BAD_CLOSE:
+            cout << "Error: Edge list should end with '}'.\n";
+            break;
     }
 
     adjacencyList.clear();
@@ -152,100 +171,223 @@ void handleEdgeCommand(string &line, int vertexCount, vector<pair<int, int>> &ed
 }
 
 void findVertexCover(int v, vector<pair<int, int>> &edges) {
-    // Create a unique set of vertices from edges
-    set<int> setVertices;
-    for (const auto& pair : edges) {
-        setVertices.insert(pair.first);
-        setVertices.insert(pair.second);
+    vector<int> cover;
+
+    if (searchStrategy == SEARCH_LINEAR) {
+        // Try each possible vertex cover size from 1 to v
+        for (int k = 1; k <= v; ++k) {
+            if (solveVertexCoverForK(v, edges, k, cover)) {
+                break;
+            }
+        }
+    } else {
+        // The endpoints of a maximal matching M form a cover and every cover
+        // needs one endpoint per matched edge, so |M| <= k <= 2|M|
+        vector<bool> matched(v + 1, false);
+        for (const auto &edge : edges) {
+            if (!matched[edge.first] && !matched[edge.second]) {
+                matched[edge.first] = matched[edge.second] = true;
+                cover.push_back(edge.first);
+                cover.push_back(edge.second);
+            }
+        }
+        int lower = cover.size() / 2;
+        int upper = cover.size();
+        vector<int> found;
+
+        // Galloping probes upper-1, upper-3, upper-7, ... until the first UNSAT answer
+        if (searchStrategy == SEARCH_GALLOPING) {
+            for (int step = 1; lower < upper; step *= 2) {
+                int k = max(lower, upper - step);
+                if (!solveVertexCoverForK(v, edges, k, found)) {
+                    lower = k + 1;
+                    break;
+                }
+                // The model may use fewer than k vertices
+                upper = found.size();
+                cover.swap(found);
+            }
+        }
+
+        while (lower < upper) {
+            int k = lower + (upper - lower) / 2;
+            if (solveVertexCoverForK(v, edges, k, found)) {
+                upper = found.size();
+                cover.swap(found);
+            } else {
+                lower = k + 1;
+            }
+        }
     }
 
+    // Sort vertices in ascending order
+    sort(cover.begin(), cover.end());
+
+    // Output the vertex cover; std::cin is tied to std::cout, so it is flushed before the next read
+    static OutputBuffer output;
+    for (size_t i = 0; i < cover.size(); ++i) {
+        output.putInt(cover[i]);
+        if (i < cover.size() - 1) {
+            output.put(' ');
+        }
+    }
+    output.put('\n');
+    output.drain();
+}
+
+bool solveVertexCoverForK(int v, const vector<pair<int, int>> &edges, int k, vector<int> &cover) {
+    if (encoding == ENCODING_SEQUENTIAL_COUNTER) {
+        return solveCounterCoverForK(v, edges, k, cover);
+    }
+    return solvePositionCoverForK(v, edges, k, cover);
+}
+
+bool solvePositionCoverForK(int v, const vector<pair<int, int>> &edges, int k, vector<int> &cover) {
     // Create solver instance
     unique_ptr<Solver> solver(new Solver());
 
-    // Try each possible vertex cover size from 1 to v
-    for (int k = 1; k <= v; ++k) {
-        // Create 2D vector of literals (vertices x positions)
-        vector<vector<Lit>> literals_2d(v + 1, vector<Lit>(k + 1));
-        
-        // Create variables for each vertex-position pair
-        for (int i = 1; i <= v; ++i) {
-            for (int j = 1; j <= k; ++j) {
-                literals_2d[i][j] = mkLit(solver->newVar());
+    // Create 2D vector of literals (vertices x positions)
+    vector<vector<Lit>> literals_2d(v + 1, vector<Lit>(k + 1));
+
+    // Create variables for each vertex-position pair
+    for (int i = 1; i <= v; ++i) {
+        for (int j = 1; j <= k; ++j) {
+            literals_2d[i][j] = mkLit(solver->newVar());
+        }
+    }
+
+    // 1. At least one vertex is the ith vertex in the cover
+    for (int i = 1; i <= k; ++i) {
+        vec<Lit> clause;
+        for (int n = 1; n <= v; ++n) {
+            clause.push(literals_2d[n][i]);
+        }
+        solver->addClause(clause);
+    }
+
+    // 2. No vertex appears twice in the cover
+    if (k > 1) {
+        for (int n = 1; n <= v; ++n) {
+            for (int pos1 = 1; pos1 <= k; ++pos1) {
+                for (int pos2 = pos1 + 1; pos2 <= k; ++pos2) {
+                    vec<Lit> clause;
+                    clause.push(~literals_2d[n][pos1]);
+                    clause.push(~literals_2d[n][pos2]);
+                    solver->addClause(clause);
+                }
             }
         }
+    }
 
-        // 1. At least one vertex is the ith vertex in the cover
-        for (int i = 1; i <= k; ++i) {
-            vec<Lit> clause;
-            for (int n = 1; n <= v; ++n) {
-                clause.push(literals_2d[n][i]);
+    // 3. No position in the cover contains two vertices
+    for (int pos = 1; pos <= k; ++pos) {
+        for (int v1 = 1; v1 <= v; ++v1) {
+            for (int v2 = v1 + 1; v2 <= v; ++v2) {
+                vec<Lit> clause;
+                clause.push(~literals_2d[v1][pos]);
+                clause.push(~literals_2d[v2][pos]);
+                solver->addClause(clause);
             }
-            solver->addClause(clause);
         }
+    }
 
-        // 2. No vertex appears twice in the cover
-        if (k > 1) {
+    // 4. Every edge is incident to at least one vertex in the cover
+    for (const auto& edge : edges) {
+        vec<Lit> clause;
+        for (int pos = 1; pos <= k; ++pos) {
+            clause.push(literals_2d[edge.first][pos]);
+            clause.push(literals_2d[edge.second][pos]);
+        }
+        solver->addClause(clause);
+    }
+
+    // 5. A vertex at position pos + 1 has a larger index than the one at pos
+    if (breakSymmetry) {
+        for (int pos = 1; pos < k; ++pos) {
             for (int n = 1; n <= v; ++n) {
-                for (int pos1 = 1; pos1 <= k; ++pos1) {
-                    for (int pos2 = pos1 + 1; pos2 <= k; ++pos2) {
-                        vec<Lit> clause;
-                        clause.push(~literals_2d[n][pos1]);
-                        clause.push(~literals_2d[n][pos2]);
-                        solver->addClause(clause);
-                    }
+                vec<Lit> clause;
+                clause.push(~literals_2d[n][pos + 1]);
+                for (int smaller = 1; smaller < n; ++smaller) {
+                    clause.push(literals_2d[smaller][pos]);
                 }
+                solver->addClause(clause);
             }
         }
+    }
 
-        // 3. No position in the cover contains two vertices
-        for (int pos = 1; pos <= k; ++pos) {
-            for (int v1 = 1; v1 <= v; ++v1) {
-                for (int v2 = v1 + 1; v2 <= v; ++v2) {
-                    vec<Lit> clause;
-                    clause.push(~literals_2d[v1][pos]);
-                    clause.push(~literals_2d[v2][pos]);
-                    solver->addClause(clause);
-                }
+    // Solve and collect the cover if satisfiable
+    if (!solver->solve()) {
+        return false;
+    }
+
+    cover.clear();
+    for (int i = 1; i <= v; ++i) {
+        for (int j = 1; j <= k; ++j) {
+            if (solver->modelValue(literals_2d[i][j]) == l_True) {
+                cover.push_back(i);
+                break;
             }
         }
+    }
+    return true;
+}
+
+bool solveCounterCoverForK(int v, const vector<pair<int, int>> &edges, int k, vector<int> &cover) {
+    unique_ptr<Solver> solver(new Solver());
 
-        // 4. Every edge is incident to at least one vertex in the cover
-        for (const auto& edge : edges) {
-            vec<Lit> clause;
-            for (int pos = 1; pos <= k; ++pos) {
-                clause.push(literals_2d[edge.first][pos]);
-                clause.push(literals_2d[edge.second][pos]);
+    // One variable per vertex that touches an edge
+    vector<Lit> vertexLit(v + 1, lit_Undef);
+    vector<int> inputs;
+    for (const auto &edge : edges) {
+        for (int n : {edge.first, edge.second}) {
+            if (vertexLit[n] == lit_Undef) {
+                vertexLit[n] = mkLit(solver->newVar());
+                inputs.push_back(n);
             }
-            solver->addClause(clause);
-        }
-
-        // Solve and output if satisfiable
-        if (solver->solve()) {
-            vector<int> cover;
-            for (int i = 1; i <= v; ++i) {
-                for (int j = 1; j <= k; ++j) {
-                    if (solver->modelValue(literals_2d[i][j]) == l_True) {
-                        cover.push_back(i);
-                        break;
-                    }
-                }
+        }
+    }
+
+    // 1. Every edge is incident to at least one vertex in the cover
+    for (const auto &edge : edges) {
+        solver->addClause(vertexLit[edge.first], vertexLit[edge.second]);
+    }
+
+    // 2. At most k vertices are in the cover. counter[i][j] means at least
+    //    j + 1 of the first i + 1 inputs are chosen; only j < k is needed
+    //    because the (k + 1)-th one is forbidden directly.
+    int n = inputs.size();
+    if (k < n) {
+        vector<vector<Lit>> counter(n, vector<Lit>(k));
+        for (int i = 0; i < n; ++i) {
+            for (int j = 0; j < k; ++j) {
+                counter[i][j] = mkLit(solver->newVar());
+            }
+        }
+        for (int i = 0; i < n; ++i) {
+            Lit x = vertexLit[inputs[i]];
+            solver->addClause(~x, counter[i][0]);
+            if (i == 0) {
+                continue;
             }
-            
-            // Sort vertices in ascending order
-            sort(cover.begin(), cover.end());
-            
-            // Output the vertex cover
-            for (size_t i = 0; i < cover.size(); ++i) {
-                cout << cover[i];
-                if (i < cover.size() - 1) {
-                    cout << " ";
+            for (int j = 0; j < k; ++j) {
+                solver->addClause(~counter[i - 1][j], counter[i][j]);
+                if (j > 0) {
+                    solver->addClause(~x, ~counter[i - 1][j - 1], counter[i][j]);
                 }
             }
-            cout << endl;
-            return;
+            solver->addClause(~x, ~counter[i - 1][k - 1]);
         }
+    }
+
+    if (!solver->solve()) {
+        return false;
+    }
 
-        // Reset solver for next iteration
-        solver.reset(new Solver());
+    cover.clear();
+    for (int i = 1; i <= v; ++i) {
+        if (vertexLit[i] != lit_Undef && solver->modelValue(vertexLit[i]) == l_True) {
+            cover.push_back(i);
+        }
     }
-}
\ No newline at end of file
+    return true;
+}
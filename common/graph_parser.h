@@ -0,0 +1,312 @@
+#ifndef GRAPH_PARSER_H
+#define GRAPH_PARSER_H
+
+#include <climits>
+
+// Supplies one input line in pieces, so a line never has to be held in
+// memory as a whole
+class LineSource
+{
+public:
+    virtual ~LineSource() {}
+
+    // Next piece of the current line, without the '\n'; false once the
+    // line is used up. The piece stays valid until the following call.
+    virtual bool nextPiece(const char *&begin, const char *&end) = 0;
+};
+
+// Allocation-free reader for the V / E / s command language, shared by
+// every tool in the repository. It works in place on a raw character range
+// or on the pieces of a LineSource, and mirrors std::istream extraction so
+// the tools keep their exact error behaviour: each read skips leading
+// whitespace, a failed read sets a sticky fail flag, and eof() turns true
+// once a read has run into the end of the line.
+class CommandScanner
+{
+public:
+    CommandScanner(const char *begin, const char *end)
+        : source(nullptr), cursor(begin), end(end), failed(false), atEnd(false)
+    {
+    }
+
+    explicit CommandScanner(LineSource &source)
+        : source(&source), cursor(nullptr), end(nullptr), failed(false), atEnd(false)
+    {
+    }
+
+    // Same as `input >> c`; c is left alone when nothing could be read
+    bool readChar(char &c)
+    {
+        if (!skipSpace())
+        {
+            return false;
+        }
+        c = *cursor++;
+        return true;
+    }
+
+    // Same as `input >> value`: left alone if the input had already failed or
+    // ran out, 0 if no number follows, clamped to the int range on overflow
+    bool readInt(int &value)
+    {
+        if (!skipSpace())
+        {
+            return false;
+        }
+        bool negative = false;
+        if (*cursor == '+' || *cursor == '-')
+        {
+            negative = *cursor == '-';
+            ++cursor;
+            if (!more())
+            {
+                atEnd = true;
+            }
+        }
+        if (!more() || *cursor < '0' || *cursor > '9')
+        {
+            failed = true;
+            value = 0;
+            return false;
+        }
+        long long magnitude = 0;
+        bool overflow = false;
+        for (; more() && *cursor >= '0' && *cursor <= '9'; ++cursor)
+        {
+            magnitude = magnitude * 10 + (*cursor - '0');
+            if (magnitude > static_cast<long long>(INT_MAX) + 1)
+            {
+                overflow = true;
+                magnitude = static_cast<long long>(INT_MAX) + 1;
+            }
+        }
+        if (!more())
+        {
+            atEnd = true;
+        }
+        if (overflow || (!negative && magnitude > INT_MAX))
+        {
+            failed = true;
+            value = negative ? INT_MIN : INT_MAX;
+            return false;
+        }
+        value = static_cast<int>(negative ? -magnitude : magnitude);
+        return true;
+    }
+
+    // Next non-space character without consuming it, like >> followed by putback
+    bool peekChar(char &c)
+    {
+        if (!readChar(c))
+        {
+            // putback clears eofbit even when the read before it failed
+            atEnd = false;
+            return false;
+        }
+        // The character just read is always in the current piece
+        --cursor;
+        return true;
+    }
+
+    // Next character, whitespace included, without consuming it or touching
+    // the stream state; false at the end of the line
+    bool peekRawChar(char &c)
+    {
+        if (failed || !more())
+        {
+            return false;
+        }
+        c = *cursor;
+        return true;
+    }
+
+    bool fail() const { return failed; }
+    bool eof() const { return atEnd; }
+
+private:
+    bool skipSpace()
+    {
+        if (failed)
+        {
+            return false;
+        }
+        while (more() && (*cursor == ' ' || (*cursor >= '\t' && *cursor <= '\r')))
+        {
+            ++cursor;
+        }
+        if (!more())
+        {
+            atEnd = true;
+            failed = true;
+            return false;
+        }
+        return true;
+    }
+
+    // True while characters are left, moving on to the source's next piece
+    // when the current one is used up
+    bool more()
+    {
+        while (cursor == end)
+        {
+            if (source == nullptr || !source->nextPiece(cursor, end))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    LineSource *source;
+    const char *cursor;
+    const char *end;
+    bool failed;
+    bool atEnd;
+};
+
+enum EdgeListError
+{
+    EDGE_LIST_OK,
+    // strict: the list does not open with '{'
+    EDGE_LIST_BAD_OPEN,
+    // strict: an edge does not open with '<'
+    EDGE_BAD_OPEN,
+    // strict: an edge is not of the form <a,b>
+    EDGE_BAD_FORMAT,
+    // an endpoint is outside 1..vertexCount, or both endpoints are equal
+    EDGE_OUT_OF_RANGE,
+    // strict: the sink rejected an edge as a duplicate
+    EDGE_DUPLICATE,
+    // strict: edges are not separated by ','
+    EDGE_BAD_SEPARATOR,
+    // strict: the list does not close with '}'
+    EDGE_LIST_BAD_CLOSE
+};
+
+struct EdgeListResult
+{
+    EdgeListError error;
+    // Endpoints of the edge an EDGE_OUT_OF_RANGE or EDGE_DUPLICATE refers to
+    int first;
+    int second;
+    // A '}' appeared where the next edge should have started
+    bool closedEarly;
+    // lenient: the sink rejected at least one edge
+    bool duplicate;
+};
+
+// What the original readers' per-edge variables held. They were declared
+// without an initialiser, so a read that failed at the end of the line left
+// the previous edge's values in place; a tool whose reader kept them in its
+// main loop carries one of these from one edge list to the next.
+struct EdgeReadState
+{
+    char edgeOpen;
+    int first;
+    char comma;
+    int second;
+    char edgeClose;
+};
+
+// Parses `{<a,b>,<c,d>,...}` with input positioned just after the 'E' and
+// hands every edge to addEdge(a, b), which returns false for a duplicate.
+// Strict parsing checks every delimiter and stops at the first problem.
+// Lenient parsing follows the original project reader: delimiters are
+// skipped unchecked, duplicates are only flagged, and only a bad endpoint
+// stops it.
+template <typename EdgeSink>
+EdgeListResult parseEdgeList(CommandScanner &input, int vertexCount, bool strict, EdgeSink addEdge,
+                             EdgeReadState &state)
+{
+    EdgeListResult result = {EDGE_LIST_OK, 0, 0, false, false};
+    char open = '\0';
+    input.readChar(open);
+    if (strict && open != '{')
+    {
+        result.error = EDGE_LIST_BAD_OPEN;
+        return result;
+    }
+
+    char next = '\0';
+    if (strict)
+    {
+        input.peekChar(next);
+        if (next == '}')
+        {
+            input.readChar(next);
+            result.closedEarly = true;
+            return result;
+        }
+    }
+
+    while (!input.eof())
+    {
+        input.readChar(state.edgeOpen);
+        if (state.edgeOpen == '}')
+        {
+            result.closedEarly = true;
+            break;
+        }
+        if (strict && state.edgeOpen != '<')
+        {
+            result.error = EDGE_BAD_OPEN;
+            return result;
+        }
+
+        input.readInt(state.first);
+        input.readChar(state.comma);
+        input.readInt(state.second);
+        input.readChar(state.edgeClose);
+        if (strict && (state.comma != ',' || state.edgeClose != '>'))
+        {
+            result.error = EDGE_BAD_FORMAT;
+            return result;
+        }
+
+        int first = state.first;
+        int second = state.second;
+        result.first = first;
+        result.second = second;
+        if (first < 1 || first > vertexCount || second < 1 || second > vertexCount || first == second)
+        {
+            result.error = EDGE_OUT_OF_RANGE;
+            return result;
+        }
+        if (!addEdge(first, second))
+        {
+            if (strict)
+            {
+                result.error = EDGE_DUPLICATE;
+                return result;
+            }
+            result.duplicate = true;
+        }
+
+        input.readChar(next);
+        if (next == '}')
+        {
+            break;
+        }
+        if (strict && next != ',')
+        {
+            result.error = EDGE_BAD_SEPARATOR;
+            return result;
+        }
+    }
+
+    if (strict && next != '}')
+    {
+        result.error = EDGE_LIST_BAD_CLOSE;
+    }
+    return result;
+}
+
+// Same, for a reader whose edge variables lived only as long as one list
+template <typename EdgeSink>
+EdgeListResult parseEdgeList(CommandScanner &input, int vertexCount, bool strict, EdgeSink addEdge)
+{
+    EdgeReadState state = {'\0', 0, '\0', 0, '\0'};
+    return parseEdgeList(input, vertexCount, strict, addEdge, state);
+}
+
+#endif
@@ -0,0 +1,107 @@
+#ifndef LINE_STREAM_H
+#define LINE_STREAM_H
+
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <vector>
+#include <unistd.h>
+#include "graph_parser.h"
+
+// Reads lines from a file descriptor through one fixed-size buffer and hands
+// each line out in pieces, so even an E line with millions of edges costs
+// no more than the buffer. Lines come out exactly as a
+// while (!std::cin.eof()) std::getline loop would see them: whatever
+// follows the final '\n' is one more line. read() returns whatever is
+// available, so interactive pipes are answered line by line.
+class StreamLineReader : public LineSource
+{
+public:
+    explicit StreamLineReader(int fd, size_t bufferSize = 1 << 16)
+        : fd(fd), buffer(bufferSize), position(0), filled(0), started(false), lineDone(false), endedByNewline(false)
+    {
+    }
+
+    // Moves on to the next line, dropping whatever is left of the current
+    // one; false once the input is used up
+    bool nextLine()
+    {
+        if (started)
+        {
+            const char *begin = nullptr;
+            const char *end = nullptr;
+            while (nextPiece(begin, end))
+            {
+            }
+            if (!endedByNewline)
+            {
+                return false;
+            }
+        }
+        started = true;
+        lineDone = false;
+        endedByNewline = false;
+        return true;
+    }
+
+    bool nextPiece(const char *&begin, const char *&end)
+    {
+        if (lineDone)
+        {
+            return false;
+        }
+        if (position == filled && !fill())
+        {
+            lineDone = true;
+            return false;
+        }
+        const char *data = buffer.data();
+        const void *newline = std::memchr(data + position, '\n', filled - position);
+        begin = data + position;
+        if (newline == nullptr)
+        {
+            end = data + filled;
+            position = filled;
+        }
+        else
+        {
+            end = static_cast<const char *>(newline);
+            position = end - data + 1;
+            lineDone = true;
+            endedByNewline = true;
+        }
+        return true;
+    }
+
+private:
+    bool fill()
+    {
+        // std::cin is tied to std::cout; keep flushing before every read so
+        // an interactive driver sees each answer before we block for input
+        std::cout.flush();
+        ssize_t count;
+        do
+        {
+            count = read(fd, buffer.data(), buffer.size());
+        } while (count < 0 && errno == EINTR);
+        if (count <= 0)
+        {
+            return false;
+        }
+        position = 0;
+        filled = count;
+        return true;
+    }
+
+    int fd;
+    std::vector<char> buffer;
+    // Unread bytes are buffer[position .. filled)
+    size_t position;
+    size_t filled;
+    bool started;
+    // The current line has no pieces left, and whether a '\n' ended it
+    bool lineDone;
+    bool endedByNewline;
+};
+
+#endif
@@ -0,0 +1,105 @@
+#ifndef OUTPUT_BUFFER_H
+#define OUTPUT_BUFFER_H
+
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+// Collects result text in one reusable buffer and hands it to std::cout in
+// a single write, instead of one formatted insertion per integer. Text only
+// reaches the stream at the explicit drain() and flush() points, or when
+// the buffer fills up.
+class OutputBuffer
+{
+public:
+    explicit OutputBuffer(size_t capacity = 1 << 16)
+        : buffer(capacity), used(0)
+    {
+    }
+
+    ~OutputBuffer()
+    {
+        drain();
+    }
+
+    OutputBuffer &put(char c)
+    {
+        makeRoom(1);
+        buffer[used++] = c;
+        return *this;
+    }
+
+    OutputBuffer &put(const char *text)
+    {
+        size_t length = std::strlen(text);
+        if (length > buffer.size())
+        {
+            drain();
+            std::cout.write(text, length);
+            return *this;
+        }
+        makeRoom(length);
+        std::memcpy(buffer.data() + used, text, length);
+        used += length;
+        return *this;
+    }
+
+    OutputBuffer &putInt(int value)
+    {
+        // Digits come out lowest first; unsigned so INT_MIN negates safely
+        char digits[10];
+        int length = 0;
+        unsigned magnitude = value < 0 ? 0u - static_cast<unsigned>(value) : static_cast<unsigned>(value);
+        do
+        {
+            digits[length++] = static_cast<char>('0' + magnitude % 10);
+            magnitude /= 10;
+        } while (magnitude != 0);
+
+        makeRoom(length + 1);
+        if (value < 0)
+        {
+            buffer[used++] = '-';
+        }
+        while (length > 0)
+        {
+            buffer[used++] = digits[--length];
+        }
+        return *this;
+    }
+
+    // Hands the buffered text to std::cout without flushing it, keeping
+    // its order relative to anything else written to std::cout
+    void drain()
+    {
+        if (used > 0)
+        {
+            std::cout.write(buffer.data(), used);
+            used = 0;
+        }
+    }
+
+    // Same, then flushes std::cout so the text is visible right away
+    void flush()
+    {
+        drain();
+        std::cout.flush();
+    }
+
+private:
+    OutputBuffer(const OutputBuffer &);
+    OutputBuffer &operator=(const OutputBuffer &);
+
+    void makeRoom(size_t length)
+    {
+        if (used + length > buffer.size())
+        {
+            drain();
+        }
+    }
+
+    std::vector<char> buffer;
+    size_t used;
+};
+
+#endif
@@ -0,0 +1,65 @@
+#include "components.h"
+
+namespace
+{
+int findRoot(std::vector<int> &parent, int vertex)
+{
+    while (parent[vertex] != vertex)
+    {
+        parent[vertex] = parent[parent[vertex]];
+        vertex = parent[vertex];
+    }
+    return vertex;
+}
+}
+
+std::vector<Component> splitComponents(int v, const std::vector<std::pair<int, int>> &pairVector)
+{
+    std::vector<int> parent(v + 1);
+    for (int i = 0; i <= v; ++i)
+    {
+        parent[i] = i;
+    }
+    for (const auto &pair : pairVector)
+    {
+        int a = findRoot(parent, pair.first);
+        int b = findRoot(parent, pair.second);
+        if (a != b)
+        {
+            parent[a] = b;
+        }
+    }
+
+    // Number the components by their smallest vertex and relabel inside each
+    std::vector<Component> components;
+    std::vector<int> componentOf(v + 1, -1);
+    std::vector<int> index(v + 1, 0);
+    std::vector<bool> hasEdge(v + 1, false);
+    for (const auto &pair : pairVector)
+    {
+        hasEdge[pair.first] = true;
+        hasEdge[pair.second] = true;
+    }
+    for (int i = 1; i <= v; ++i)
+    {
+        if (!hasEdge[i])
+        {
+            continue;
+        }
+        int root = findRoot(parent, i);
+        if (componentOf[root] < 0)
+        {
+            componentOf[root] = components.size();
+            components.push_back({0, {}, {0}});
+        }
+        Component &component = components[componentOf[root]];
+        index[i] = ++component.v;
+        component.label.push_back(i);
+    }
+    for (const auto &pair : pairVector)
+    {
+        Component &component = components[componentOf[findRoot(parent, pair.first)]];
+        component.pairVector.emplace_back(index[pair.first], index[pair.second]);
+    }
+    return components;
+}
@@ -0,0 +1,20 @@
+#ifndef COMPONENTS_H
+#define COMPONENTS_H
+
+#include <vector>
+#include <utility>
+
+// A connected component with its vertices relabelled to 1..v
+struct Component
+{
+    int v;
+    std::vector<std::pair<int, int>> pairVector;
+    // label[i]: vertex of the input graph that is vertex i here (label[0] unused)
+    std::vector<int> label;
+};
+
+// Splits the edge list into connected components with union-find. Vertices
+// without edges need no cover and are left out. Edges keep their input order.
+std::vector<Component> splitComponents(int v, const std::vector<std::pair<int, int>> &pairVector);
+
+#endif
@@ -1,105 +1,328 @@
 #include <iostream>
-#include <sstream>
 #include <vector>
-#include <set>
-#include <unordered_map>
-#include <queue>
-#include <list>
 #include <memory>
 #include <algorithm>
-#include <time.h>
 #include <pthread.h>
-#include <map>
 #include <atomic>
-#include <numeric>
 #include <chrono>
-#include "minisat/core/Solver.h"
-#include "minisat/core/SolverTypes.h"
-using namespace Minisat;
+#include <thread>
+#include <deque>
+#include <cstdlib>
+#include <fstream>
+#include "sat_vc.h"
+#include "kernel.h"
+#include "thread_pool.h"
+#include "graph.h"
+#include "graph_parser.h"
+#include "line_reader.h"
+#include "graph_file.h"
+#include "output_buffer.h"
+#include "timing.h"
+#include "stats.h"
+#include "vertex_cover.h"
+#include "lower_bound.h"
+
+enum ResultStatus
+{
+    RESULT_RUNNING,
+    RESULT_DONE,
+    RESULT_TIMEOUT
+};
 
-struct ThreadArgs
+// Outcome of one algorithm on one graph
+struct AlgorithmResult
 {
-    int v;
-    std::vector<std::pair<int, int>> pairVector;
+    AlgorithmResult() : lowerBound(-1), cpuMicros(0), wallMicros(0), status(RESULT_RUNNING) {}
+
+    std::vector<int> cover;
+    // CNF-SAT-VC timeout: cover is the best one found and lowerBound a proven
+    // lower bound on the minimum; -1 when the algorithm did not run
+    int lowerBound;
+    // CPU time of every thread that worked on it, and elapsed time, in microseconds
+    double cpuMicros;
+    double wallMicros;
+    std::chrono::steady_clock::time_point finished;
+    // Stored last, once everything above is final
+    std::atomic<ResultStatus> status;
+};
+
+// One graph in flight: what its algorithms run on and what they produce
+struct GraphTask
+{
+    // The input graph, or its kernel with --kernelize
+    std::unique_ptr<const CsrGraph> graph;
+    // Vertex count of the input graph, before any kernelization
+    int vertices;
+    std::unique_ptr<Kernel> kernel;
+    // CNF-SAT-VC is skipped and reported as a timeout when false
+    bool runSat;
+    // Set once this graph's CNF-SAT-VC deadline has passed
+    std::atomic<bool> timedOut;
+    AlgorithmResult sat;
+    AlgorithmResult approx1;
+    AlgorithmResult approx2;
+    // Result lines already printed, and the cover size ratios are taken against
+    int printed;
+    int optimalCover;
+    // Best lower bound on the minimum cover of the input graph, for the
+    // statistics; only computed when they are wanted, and set before boundReady
+    int lowerBound;
+    std::atomic<bool> boundReady;
+    // From submission until the last algorithm finished, in microseconds
+    std::chrono::steady_clock::time_point submitted;
+    double wallMicros;
+    // Error messages for input lines after this graph, printed right after it
+    std::vector<std::pair<std::ostream *, std::string>> trailing;
+};
+
+// Prints result lines in input order, each as soon as it and every line
+// before it are ready. Workers call flush() whenever an algorithm finishes.
+class ResultPrinter
+{
+public:
+    ResultPrinter();
+    ~ResultPrinter();
+
+    GraphTask *add(std::unique_ptr<GraphTask> task);
+    void flush();
+    // Writes message to stream once every graph added so far is printed
+    void report(std::ostream &stream, const char *message);
+    // Blocks while limit or more graphs still have lines to print
+    void waitBelow(size_t limit);
+
+private:
+    pthread_mutex_t mutex;
+    pthread_cond_t printed;
+    std::deque<std::unique_ptr<GraphTask>> pending;
+    // Lines released by one flush() go out in a single write
+    OutputBuffer output;
 };
 
 void *findVectorCoverWrapper(void *arg);
 void *findVectorCover_1Wrapper(void *arg);
 void *findVectorCover_2Wrapper(void *arg);
+void *lowerBoundWrapper(void *arg);
 void *ioHandlerWrapper(void *arg);
-// double calculateMean(const std::vector<double> &ratios);
-// double calculateStandardDeviation(const std::vector<double> &ratios, double mean);
-
-void findVectorCover(int v, std::vector<std::pair<int, int>> pairVector);
-void findVectorCover_1(int v, std::vector<std::pair<int, int>> pairVector);
-void findVectorCover_2(int v, std::vector<std::pair<int, int>> pairVector);
-
-std::vector<int> finalResult_Vector_1;
-std::vector<int> finalResult_Vector_2;
-std::vector<int> finalResult_Vector_3;
-int globalOptimalCover;
-void print_Vector1_result();
-void print_Vector2_result();
-void print_Vector3_result();
-
-double duration_1;
-double duration_2;
-double duration_3;
+void *graphFileHandlerWrapper(void *arg);
+void submitGraph(std::unique_ptr<const CsrGraph> graph, bool runSat, ResultPrinter &printer, ThreadPool &pool);
+
+void print_Vector1_result(GraphTask &task, OutputBuffer &output);
+void print_Vector2_result(GraphTask &task, OutputBuffer &output);
+void print_Vector3_result(GraphTask &task, OutputBuffer &output);
+void printTimingLines(const GraphTask &task);
+void recordStats(const GraphTask &task);
+
 bool flag = true;
-std::atomic<bool> timed_out(false);
-std::vector<double> t1_ratios; // Store t1 approximation ratios
-std::vector<double> t2_ratios; // Store t2 approximation ratios
-std::vector<double> t3_ratios;
-
-std::vector<double> t1_run; // Store t1 approximation ratios
-std::vector<double> t2_run; // Store t2 approximation ratios
-std::vector<double> t3_run;
-
-std::atomic<double>
-    t1_app(0.0);
-std::atomic<double> t2_app(0.0);
-std::atomic<double> t3_app(0.0);
+
+// Run every algorithm on the reduced kernel and lift the covers back
+bool kernelize = false;
+// Graphs allowed in flight at once; results are still printed in input order
+size_t batchSize = 1;
+// Report CPU and wall time of every algorithm on stderr
+bool printTiming = false;
+// Ratios and run times of every finished graph, only touched under the printer's lock
+RunStats runStats;
+// End-of-run statistics report on stdout, and/or as JSON to a file
+bool printStats = false;
+std::string statsJsonPath;
 pthread_t ioThread;
+void submitGraph(std::unique_ptr<const CsrGraph> graph, bool runSat, ResultPrinter &printer, ThreadPool &pool)
+{
+    std::unique_ptr<GraphTask> task(new GraphTask());
+    // Kernelization is part of the graph's wall time
+    task->submitted = std::chrono::steady_clock::now();
+    task->vertices = graph->v;
+    if (kernelize)
+    {
+        task->kernel.reset(new Kernel(graph->v, graph->pairVector));
+        graph.reset(new CsrGraph(task->kernel->v, task->kernel->pairVector));
+    }
+    task->graph = std::move(graph);
+    task->runSat = runSat;
+    task->timedOut = false;
+    task->printed = 0;
+    task->optimalCover = 1;
+    task->lowerBound = -1;
+    // Lower bounds only feed the statistics report
+    bool wantBound = printStats || !statsJsonPath.empty();
+    task->boundReady = !wantBound;
+    task->wallMicros = 0;
+
+    // The jobs share the task's read-only graph. CNF-SAT-VC starts from the
+    // APPROX-VC-1 cover, so it follows it in the same job
+    GraphTask *shared = printer.add(std::move(task));
+    ResultPrinter *output = &printer;
+    pool.submit([shared, output]()
+                { findVectorCover_1Wrapper(shared); findVectorCoverWrapper(shared); output->flush(); });
+    pool.submit([shared, output]()
+                { findVectorCover_2Wrapper(shared); output->flush(); });
+    if (wantBound)
+    {
+        pool.submit([shared, output]()
+                    { lowerBoundWrapper(shared); output->flush(); });
+    }
+    printer.waitBelow(batchSize);
+}
+
+void *graphFileHandlerWrapper(void *arg)
+{
+    GraphFileReader &reader = *static_cast<GraphFileReader *>(arg);
+    // Declared first so it outlives the workers that flush it
+    ResultPrinter printer;
+    ThreadPool pool(std::max(3u, std::thread::hardware_concurrency()));
+    std::unique_ptr<const CsrGraph> graph;
+    while (reader.next(graph))
+    {
+        // Same rule as the text input: CNF-SAT-VC only runs for 5, 10 and 15 vertices
+        bool runSat = graph->v == 5 || graph->v == 10 || graph->v == 15;
+        submitGraph(std::move(graph), runSat, printer, pool);
+    }
+    if (reader.corrupt())
+    {
+        printer.report(std::cerr, "Error: Corrupt graph file \n");
+    }
+
+    printer.waitBelow(1);
+    return nullptr;
+}
+
 int main(int argc, char **argv)
 {
-    pthread_create(&ioThread, nullptr, ioHandlerWrapper, nullptr);
+    LineReader reader;
+    GraphFileReader graphFile;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if ((arg == "--sat-mode" || arg == "--search" || arg == "--encoding") && i + 1 < argc)
+        {
+            if (!parseSatOption(argv[i], argv[i + 1]))
+            {
+                return 1;
+            }
+            ++i;
+        }
+        else if (arg == "--kernelize")
+        {
+            kernelize = true;
+        }
+        else if (arg == "--components")
+        {
+            splitIntoComponents = true;
+        }
+        else if (arg == "--phase-hints")
+        {
+            satPhaseHints = true;
+        }
+        else if (arg == "--symmetry-breaking")
+        {
+            satSymmetryBreaking = true;
+        }
+        else if (arg == "--stats")
+        {
+            printStats = true;
+        }
+        else if (arg == "--stats-json" && i + 1 < argc)
+        {
+            statsJsonPath = argv[++i];
+        }
+        else if (arg == "--timing")
+        {
+            printTiming = true;
+        }
+        else if (arg == "--batch" && i + 1 < argc)
+        {
+            int size = std::atoi(argv[++i]);
+            if (size < 1)
+            {
+                std::cerr << "Error: Batch size must be positive\n";
+                return 1;
+            }
+            batchSize = size;
+        }
+        else if (arg == "--graph-file" && i + 1 < argc)
+        {
+            std::string path = argv[++i];
+            if (!graphFile.open(path))
+            {
+                std::cerr << "Error: Cannot open graph file " << path << "\n";
+                return 1;
+            }
+        }
+        else if (arg == "--input" && i + 1 < argc)
+        {
+            std::string path = argv[++i];
+            if (!reader.open(path))
+            {
+                std::cerr << "Error: Cannot open input file " << path << "\n";
+                return 1;
+            }
+        }
+        else
+        {
+            std::cerr << "Error: Unknown option " << arg << "\n";
+            return 1;
+        }
+    }
+
+    if (graphFile.isOpen())
+    {
+        pthread_create(&ioThread, nullptr, graphFileHandlerWrapper, &graphFile);
+    }
+    else
+    {
+        pthread_create(&ioThread, nullptr, ioHandlerWrapper, &reader);
+    }
     pthread_join(ioThread, nullptr);
+
+    if (printStats)
+    {
+        std::cout << "Statistics:\n";
+        runStats.writeText(std::cout);
+    }
+    if (!statsJsonPath.empty())
+    {
+        std::ofstream json(statsJsonPath);
+        runStats.writeJson(json);
+        if (!json)
+        {
+            std::cerr << "Error: Cannot write statistics to " << statsJsonPath << "\n";
+            return 1;
+        }
+    }
     return 0;
 }
 void *ioHandlerWrapper(void *arg)
 {
+    LineReader &reader = *static_cast<LineReader *>(arg);
     std::vector<std::pair<int, int>> pairVector;
-    std::atomic<double> t1_sum(0.0);
-    std::atomic<double> t2_sum(0.0);
-    std::atomic<double> t3_sum(0.0);
+    // The last graph had edges; its list has been handed over with the graph
+    bool edgesGiven = false;
     int vertices = 0;
-    std::set<int> setVertices;
-    std::unordered_map<int, std::list<int>> adjacenyList;
     bool noEdge = false;
-
-    while (!std::cin.eof())
+    // The edge reader's variables keep their values from one line to the next
+    EdgeReadState edgeState = {'\0', 0, '\0', 0, '\0'};
+    // Declared first so it outlives the workers that flush it
+    ResultPrinter printer;
+    // Workers outlive every graph; SAT blocks one of them, so keep at least three
+    ThreadPool pool(std::max(3u, std::thread::hardware_concurrency()));
+    while (reader.nextLine())
     {
-        std::string line;
-        std::getline(std::cin, line);
-        if (!(line[0] == 's'))
-        {
-            // std::cout <<line<<"\n";
-        }
-        if (line.empty() || line.find_first_not_of(" "))
+        // Edges are parsed straight off the reader's buffer, piece by piece
+        CommandScanner input(reader);
+        char first = '\0';
+        if (!input.peekRawChar(first) || first == ' ')
         {
             continue;
         }
-        std::istringstream input(line);
-        char command;
-        input >> command;
+        char command = '\0';
+        input.readChar(command);
 
         if (command == 'V')
         {
             bool valid_input = true;
             while (!input.eof())
             {
-                input >> vertices;
-                if (input.fail())
+                if (!input.readInt(vertices))
                 {
                     valid_input = false;
                     break;
@@ -108,7 +331,7 @@ void *ioHandlerWrapper(void *arg)
 
             if (valid_input == false)
             {
-                std::cerr << "Error: Invalid input for vertices \n";
+                printer.report(std::cerr, "Error: Invalid input for vertices \n");
                 continue;
             }
 
@@ -122,7 +345,7 @@ void *ioHandlerWrapper(void *arg)
                 flag = false;
             }
 
-            pairVector.clear();
+            edgesGiven = false;
             noEdge = false;
         }
 
@@ -134,491 +357,318 @@ void *ioHandlerWrapper(void *arg)
             }
             if (vertices == 0)
             {
-                std::cout << "Error: Missing vertices Input \n";
+                printer.report(std::cout, "Error: Missing vertices Input \n");
                 continue;
             }
 
-            if (pairVector.size() != 0)
+            if (edgesGiven)
             {
-                std::cerr << "Error: Missing vertices Input \n";
+                printer.report(std::cerr, "Error: Missing vertices Input \n");
                 vertices = 0;
                 continue;
             }
 
-            char edge_start;
-            input >> edge_start;
-            bool error = false;
-            bool sameEdge = false;
-
-            while (!input.eof())
+            // Duplicates are looked for once the whole list is in, which
+            // needs far less memory than a hash set of the edges seen so far
+            auto addEdge = [&](int vertice_1, int vertice_2)
             {
-                char pair_bracket_start;
-                input >> pair_bracket_start;
-
-                if (pair_bracket_start == '}')
-                {
-                    noEdge = true;
-                    break;
-                }
-
-                int vertice_1;
-                input >> vertice_1;
-
-                char comma;
-                input >> comma;
-
-                int vertice_2;
-                input >> vertice_2;
-
-                char pair_bracket_end;
-                input >> pair_bracket_end;
-
-                if (!(vertice_1 >= 1 && vertice_1 <= vertices))
-                {
-                    error = true;
-                    break;
-                }
-
-                if (!(vertice_2 >= 1 && vertice_2 <= vertices))
-                {
-                    error = true;
-                    break;
-                }
-
-                if (vertice_1 == vertice_2)
-                {
-                    error = true;
-                    break;
-                }
-
-                if (pairVector.size() > 0)
-                {
-                    for (const auto &pair : pairVector)
-                    {
-                        if (pair.first == vertice_1 && pair.second == vertice_2)
-                        {
-                            sameEdge = true;
-                        }
-                    }
-                }
-
                 pairVector.emplace_back(vertice_1, vertice_2);
-
-                char comma_or_bracket;
-                input >> comma_or_bracket;
-
-                if (comma_or_bracket == '}')
-                {
-                    break;
-                }
+                return true;
+            };
+            EdgeListResult edges = parseEdgeList(input, vertices, false, addEdge, edgeState);
+            if (edges.closedEarly)
+            {
+                noEdge = true;
             }
+            bool error = edges.error != EDGE_LIST_OK;
 
             if (error == true)
             {
                 pairVector.clear();
                 vertices = 0;
-                std::cerr << "Error: Invalid Edges \n";
+                printer.report(std::cerr, "Error: Invalid Edges \n");
                 continue;
             }
 
-            if (pairVector.size() > 1)
-            {
-                for (const auto &pair : pairVector)
-                {
-                    for (const auto &pair2 : pairVector)
-                    {
-                        if (pair.first == pair2.second && pair.second == pair2.first)
-                        {
-                            sameEdge = true;
-                        }
-                    }
-                }
-            }
-
-            if (sameEdge == true)
+            if (hasDuplicateEdge(pairVector))
             {
                 pairVector.clear();
                 vertices = 0;
-                std::cerr << "Error: Invalid Edges\n";
+                printer.report(std::cerr, "Error: Invalid Edges\n");
                 continue;
             }
 
-            adjacenyList.clear();
-
-            for (const auto &pair : pairVector)
-            {
-                int vertex_1 = pair.first;
-                int vertex_2 = pair.second;
-                adjacenyList[vertex_1].push_back(vertex_2);
-                adjacenyList[vertex_2].push_back(vertex_1);
-            }
-            ThreadArgs args1 = {vertices, pairVector};
-            ThreadArgs args2 = {vertices, pairVector};
-            ThreadArgs args3 = {vertices, pairVector};
-
-            pthread_t thread1, thread2, thread3;
-
-            pthread_create(&thread1, nullptr, findVectorCoverWrapper, &args1);
-            pthread_create(&thread2, nullptr, findVectorCover_1Wrapper, &args2);
-            pthread_create(&thread3, nullptr, findVectorCover_2Wrapper, &args3);
-
-            clockid_t clockid1;
-            int pthread_getcpuclockid(pthread_t thread1, clockid_t clockid1);
-            struct timespec start1, end1;
-            clock_gettime(clockid1, &start1);
-
-            clockid_t clockid2;
-            int pthread_getcpuclockid(pthread_t thread2, clockid_t clockid2);
-            struct timespec start2, end2;
-            clock_gettime(clockid2, &start2);
-
-            clockid_t clockid3;
-            int pthread_getcpuclockid(pthread_t thread3, clockid_t clockid3);
-            struct timespec start3, end3;
-            clock_gettime(clockid3, &start3);
-
-            pthread_join(thread1, nullptr);
-            clock_gettime(clockid1, &end1);
-            pthread_join(thread2, nullptr);
-            clock_gettime(clockid2, &end2);
-            pthread_join(thread3, nullptr);
-            clock_gettime(clockid3, &end3);
-
-            double t1 = ((end1.tv_sec - start1.tv_sec) * 1e6) + ((end1.tv_nsec - start1.tv_nsec) / 1e3);
-            double t2 = ((end2.tv_sec - start2.tv_sec) * 1e6) + ((end2.tv_nsec - start2.tv_nsec) / 1e3);
-            double t3 = ((end3.tv_sec - start3.tv_sec) * 1e6) + ((end3.tv_nsec - start3.tv_nsec) / 1e3);
-            // t1_run.push_back(t1);
-            t2_run.push_back(t2);
-            t3_run.push_back(t3);
-            // t1_sum = t1_sum + t1;
-            t2_sum = t2_sum + t2;
-            t3_sum = t3_sum + t3;
-            print_Vector1_result();
-            print_Vector2_result();
-            print_Vector3_result();
-            globalOptimalCover = 1;
+            edgesGiven = !pairVector.empty();
+            submitGraph(std::unique_ptr<const CsrGraph>(new CsrGraph(vertices, std::move(pairVector))), flag, printer, pool);
+            pairVector.clear();
+            flag = true;
         }
         else
         {
-            std::cerr << "Error: Invalid Command \n";
+            printer.report(std::cerr, "Error: Invalid Command \n");
         }
     }
+
+    printer.waitBelow(1);
+    return nullptr;
 }
 
-// double calculateMean(const std::vector<double> &ratios)
-// {
-//     double sum = std::accumulate(ratios.begin(), ratios.end(), 0.0);
-//     return sum / ratios.size();
-// }
-// double calculateStandardDeviation(const std::vector<double> &ratios, double mean)
-// {
-//     double sum_sq_diff = 0.0;
-//     for (double ratio : ratios)
-//     {
-//         sum_sq_diff += (ratio - mean) * (ratio - mean);
-//     }
-//     return std::sqrt(sum_sq_diff / ratios.size());
-// }
-void findVectorCover(int v, std::vector<std::pair<int, int>> pairVector)
+ResultPrinter::ResultPrinter()
 {
-    auto start_time = std::chrono::steady_clock::now();
-    std::set<int> setVertices;
-    for (const auto &pair : pairVector)
-    {
-
-        setVertices.insert(pair.first);
-        setVertices.insert(pair.second);
-    }
-
-    std::unique_ptr<Minisat::Solver> solver(new Minisat::Solver());
-    for (int k = 1; k <= v; ++k)
-    {
-        auto current_time = std::chrono::steady_clock::now();
-        auto elapsed_time = std::chrono::duration_cast<std::chrono::seconds>(current_time - start_time).count();
-        if (timed_out.load())
-        {
-            flag = false;
-            return;
-        }
+    pthread_mutex_init(&mutex, nullptr);
+    pthread_cond_init(&printed, nullptr);
+}
 
-        if (elapsed_time > 15)
-        {
-            timed_out.store(true);
-            flag = false;
-            return;
-        }
-        if (elapsed_time > 15)
-        {
-            timed_out.store(true);
-            flag = false;
-            return;
-        }
+ResultPrinter::~ResultPrinter()
+{
+    pthread_cond_destroy(&printed);
+    pthread_mutex_destroy(&mutex);
+}
 
-        std::vector<std::vector<Lit>> literals_2d(v + 1, std::vector<Lit>(k + 1));
-        for (int i = 1; i <= v; ++i)
-        {
-            for (int j = 1; j <= k; ++j)
-            {
-                Lit lit = mkLit(solver->newVar());
-                literals_2d[i][j] = lit;
-            }
-        }
-        for (int vertex = 1; vertex <= k; ++vertex)
-        {
+GraphTask *ResultPrinter::add(std::unique_ptr<GraphTask> task)
+{
+    GraphTask *added = task.get();
+    pthread_mutex_lock(&mutex);
+    pending.push_back(std::move(task));
+    pthread_mutex_unlock(&mutex);
+    return added;
+}
 
-            vec<Lit> clause;
-            for (int n = 1; n <= v; ++n)
-            {
-                clause.push(literals_2d[n][vertex]);
-            }
-            solver->addClause(clause);
-            clause.clear();
-        }
-        for (int n = 1; n <= v; ++n)
+void ResultPrinter::flush()
+{
+    pthread_mutex_lock(&mutex);
+    while (!pending.empty())
+    {
+        GraphTask &task = *pending.front();
+        AlgorithmResult *lines[] = {&task.sat, &task.approx1, &task.approx2};
+        while (task.printed < 3 && lines[task.printed]->status != RESULT_RUNNING)
         {
-
-            if (k > 1)
+            AlgorithmResult &result = *lines[task.printed];
+            if (task.kernel && (result.status == RESULT_DONE || result.lowerBound >= 0))
             {
-
-                for (int vertex1 = 1; vertex1 <= k; ++vertex1)
+                result.cover = task.kernel->lift(result.cover);
+                if (result.lowerBound >= 0)
                 {
-
-                    vec<Lit> clause;
-                    for (int vertex2 = vertex1 + 1; vertex2 <= k; ++vertex2)
-                    {
-                        clause.push(~literals_2d[n][vertex1]);
-                        clause.push(~literals_2d[n][vertex2]);
-                        solver->addClause(clause);
-                        clause.clear();
-                    }
+                    result.lowerBound += task.kernel->coverOffset();
                 }
             }
-        }
-        for (int vertex = 1; vertex <= k; ++vertex)
-        {
-
-            for (int n1 = 1; n1 <= v; ++n1)
+            if (task.printed == 0)
             {
-
-                vec<Lit> clause;
-                for (int n2 = n1 + 1; n2 <= v; ++n2)
-                {
-                    clause.push(~literals_2d[n1][vertex]);
-                    clause.push(~literals_2d[n2][vertex]);
-                    solver->addClause(clause);
-                    clause.clear();
-                }
+                print_Vector1_result(task, output);
             }
-        }
-        for (const auto &pair : pairVector)
-        {
-
-            int edge1 = pair.first;
-            int edge2 = pair.second;
-            vec<Lit> clause;
-
-            for (int vertex = 1; vertex <= k; ++vertex)
+            else if (task.printed == 1)
             {
-                clause.push(literals_2d[edge1][vertex]);
+                print_Vector2_result(task, output);
             }
-
-            for (int vertex = 1; vertex <= k; ++vertex)
+            else
             {
-                clause.push(literals_2d[edge2][vertex]);
+                print_Vector3_result(task, output);
             }
-
-            solver->addClause(clause);
-            clause.clear();
+            ++task.printed;
         }
-
-        bool res = solver->solve();
-        if (res == 1)
+        if (task.printed < 3 || !task.boundReady)
         {
-            for (int i = 1; i <= v; ++i)
-            {
-                for (int j = 1; j <= k; ++j)
-                {
-                    if (solver->modelValue(literals_2d[i][j]) == l_True)
-                    {
-                        finalResult_Vector_1.emplace_back(i);
-                    }
-                }
-            }
             break;
         }
-        literals_2d.clear();
-        solver.reset(new Minisat::Solver());
+        auto last = std::max({task.sat.finished, task.approx1.finished, task.approx2.finished});
+        task.wallMicros = std::chrono::duration<double, std::micro>(last - task.submitted).count();
+        recordStats(task);
+        if (printTiming)
+        {
+            // Keeps the report right after the graph's lines on a terminal
+            output.flush();
+            printTimingLines(task);
+        }
+        for (const auto &message : task.trailing)
+        {
+            output.flush();
+            *message.first << message.second;
+            message.first->flush();
+        }
+        pending.pop_front();
+        pthread_cond_broadcast(&printed);
     }
+    output.flush();
+    pthread_mutex_unlock(&mutex);
 }
-void findVectorCover_1(int v, std::vector<std::pair<int, int>> pairVector)
+
+void ResultPrinter::report(std::ostream &stream, const char *message)
 {
-    std::unordered_map<int, std::list<int>> adjacenyList;
-    for (const auto &pair : pairVector)
+    pthread_mutex_lock(&mutex);
+    if (pending.empty())
     {
-
-        adjacenyList[pair.first].push_back(pair.second);
-        adjacenyList[pair.second].push_back(pair.first);
+        output.flush();
+        stream << message;
+        stream.flush();
     }
-
-    while (adjacenyList.size() != 0)
+    else
     {
-        int vertex_max = 0;
-        int count_edges = 0;
-
-        for (const auto &pair : adjacenyList)
-        {
-            int vertex = pair.first;
-            const std::list<int> &neighbors = pair.second;
-
-            if (neighbors.size() > static_cast<size_t>(count_edges))
-            {
-                vertex_max = vertex;
-                count_edges = neighbors.size();
-            }
-        }
-
-        finalResult_Vector_2.emplace_back(vertex_max);
-
-        std::list<int> &neighbors = adjacenyList[vertex_max];
-
-        for (int value : neighbors)
-        {
-            if (adjacenyList[value].size() == 1)
-            {
-                auto it = adjacenyList.find(value);
-                if (it != adjacenyList.end())
-                {
-                    adjacenyList.erase(it);
-                }
-            }
-            else
-            {
-                adjacenyList[value].remove(vertex_max);
-            }
-        }
-
-        auto it = adjacenyList.find(vertex_max);
-        if (it != adjacenyList.end())
-        {
-            adjacenyList.erase(it);
-        }
+        pending.back()->trailing.emplace_back(&stream, message);
     }
+    pthread_mutex_unlock(&mutex);
 }
 
-void findVectorCover_2(int v, std::vector<std::pair<int, int>> pairVector)
+void ResultPrinter::waitBelow(size_t limit)
 {
-    while (pairVector.size() != 0)
+    pthread_mutex_lock(&mutex);
+    while (pending.size() >= limit)
     {
-        int first_vector = pairVector[0].first;
-        int second_vector = pairVector[0].second;
-
-        finalResult_Vector_3.emplace_back(first_vector);
-        finalResult_Vector_3.emplace_back(second_vector);
-
-        for (auto it = pairVector.begin(); it != pairVector.end();)
-        {
-            if (it->first == first_vector || it->second == first_vector)
-            {
-                it = pairVector.erase(it);
-            }
-            else
-            {
-                ++it;
-            }
-        }
-
-        for (auto it = pairVector.begin(); it != pairVector.end();)
-        {
-            if (it->first == second_vector || it->second == second_vector)
-            {
-                it = pairVector.erase(it);
-            }
-            else
-            {
-                ++it;
-            }
-        }
+        pthread_cond_wait(&printed, &mutex);
     }
+    pthread_mutex_unlock(&mutex);
 }
+
 void *findVectorCoverWrapper(void *args)
 {
-    ThreadArgs *threadArgs = reinterpret_cast<ThreadArgs *>(args);
-    if (flag == true)
+    GraphTask *task = reinterpret_cast<GraphTask *>(args);
+    Stopwatch watch;
+    double helperCpuMicros = 0;
+    int lower = 0;
+    // Runs after APPROX-VC-1 in the same job and starts from its cover
+    task->sat.cover = task->approx1.cover;
+    bool solved = task->runSat && findVectorCover(*task->graph, task->sat.cover, lower, task->timedOut, helperCpuMicros);
+    if (task->runSat && !solved)
     {
-        findVectorCover(threadArgs->v, threadArgs->pairVector);
+        task->sat.lowerBound = lower;
     }
+    task->sat.cpuMicros = watch.cpuMicros() + helperCpuMicros;
+    task->sat.wallMicros = watch.wallMicros();
+    task->sat.finished = std::chrono::steady_clock::now();
+    task->sat.status = solved ? RESULT_DONE : RESULT_TIMEOUT;
     return nullptr;
 }
 
 void *findVectorCover_1Wrapper(void *args)
 {
-    ThreadArgs *threadArgs = reinterpret_cast<ThreadArgs *>(args);
-    findVectorCover_1(threadArgs->v, threadArgs->pairVector);
+    GraphTask *task = reinterpret_cast<GraphTask *>(args);
+    Stopwatch watch;
+    findVectorCover_1(*task->graph, task->approx1.cover);
+    task->approx1.cpuMicros = watch.cpuMicros();
+    task->approx1.wallMicros = watch.wallMicros();
+    task->approx1.finished = std::chrono::steady_clock::now();
+    task->approx1.status = RESULT_DONE;
     return nullptr;
 }
 
 void *findVectorCover_2Wrapper(void *args)
 {
-    ThreadArgs *threadArgs = reinterpret_cast<ThreadArgs *>(args);
-    findVectorCover_2(threadArgs->v, threadArgs->pairVector);
+    GraphTask *task = reinterpret_cast<GraphTask *>(args);
+    Stopwatch watch;
+    findVectorCover_2(*task->graph, task->approx2.cover);
+    task->approx2.cpuMicros = watch.cpuMicros();
+    task->approx2.wallMicros = watch.wallMicros();
+    task->approx2.finished = std::chrono::steady_clock::now();
+    task->approx2.status = RESULT_DONE;
     return nullptr;
 }
 
-void print_Vector1_result()
+void *lowerBoundWrapper(void *args)
 {
-    if (flag == 0)
+    GraphTask *task = reinterpret_cast<GraphTask *>(args);
+    int bound = computeLowerBounds(*task->graph).best();
+    if (task->kernel)
     {
-        std::cout << "CNF-SAT-VC: timeout";
-        std::cout << "\n";
-        flag = true;
+        bound += task->kernel->coverOffset();
+    }
+    task->lowerBound = bound;
+    task->boundReady = true;
+    return nullptr;
+}
+
+void print_Vector1_result(GraphTask &task, OutputBuffer &output)
+{
+    if (task.sat.status == RESULT_TIMEOUT && task.sat.lowerBound < 0)
+    {
+        output.put("CNF-SAT-VC: timeout\n");
+    }
+    else if (task.sat.status == RESULT_TIMEOUT)
+    {
+        // Best cover found before the deadline and the interval the minimum lies in
+        output.put("CNF-SAT-VC: timeout [");
+        output.putInt(task.sat.lowerBound).put(", ").putInt(static_cast<int>(task.sat.cover.size())).put("] ");
+
+        std::sort(task.sat.cover.begin(), task.sat.cover.end());
+        for (int num : task.sat.cover)
+        {
+            output.putInt(num).put(' ');
+        }
+        output.put('\n');
     }
     else
     {
-        std::cout << "CNF-SAT-VC: ";
+        output.put("CNF-SAT-VC: ");
 
-        std::sort(finalResult_Vector_1.begin(), finalResult_Vector_1.end());
-        for (int num : finalResult_Vector_1)
+        std::sort(task.sat.cover.begin(), task.sat.cover.end());
+        for (int num : task.sat.cover)
         {
-            std::cout << num << " ";
+            output.putInt(num).put(' ');
         }
-        std::cout << "\n";
-        globalOptimalCover = finalResult_Vector_1.size();
-        double approx_t1 = static_cast<double>(finalResult_Vector_1.size()) / globalOptimalCover;
-        t1_ratios.push_back(approx_t1);
-        t1_app = t1_app + approx_t1;
-        // std::cout << "the duration time for algo 1 is: " << duration_1 << "\n";
-        finalResult_Vector_1.clear();
+        output.put('\n');
+        task.optimalCover = task.sat.cover.size();
     }
 }
 
-void print_Vector2_result()
+void print_Vector2_result(GraphTask &task, OutputBuffer &output)
 {
-    std::cout << "APPROX-VC-1: ";
-    std::sort(finalResult_Vector_2.begin(), finalResult_Vector_2.end());
+    output.put("APPROX-VC-1: ");
+    std::sort(task.approx1.cover.begin(), task.approx1.cover.end());
 
-    for (int num : finalResult_Vector_2)
+    for (int num : task.approx1.cover)
     {
-        std::cout << num << " ";
+        output.putInt(num).put(' ');
     }
-    double approx_t2 = static_cast<double>(finalResult_Vector_2.size()) / globalOptimalCover;
-    t2_app = t2_app + approx_t2;
-    t2_ratios.push_back(approx_t2);
-    std::cout << "\n";
-    finalResult_Vector_2.clear();
+    output.put('\n');
 }
 
-void print_Vector3_result()
+void print_Vector3_result(GraphTask &task, OutputBuffer &output)
 {
-    std::cout << "APPROX-VC-2: ";
-    std::sort(finalResult_Vector_3.begin(), finalResult_Vector_3.end());
+    output.put("APPROX-VC-2: ");
+    std::sort(task.approx2.cover.begin(), task.approx2.cover.end());
     // Printing the sorted vector
-    for (int num : finalResult_Vector_3)
+    for (int num : task.approx2.cover)
+    {
+        output.putInt(num).put(' ');
+    }
+    output.put('\n');
+}
+
+void recordStats(const GraphTask &task)
+{
+    // Ratios are only meaningful against a cover CNF-SAT-VC proved optimal
+    bool optimal = task.sat.status == RESULT_DONE;
+    // Bound ratios overestimate the true ratio but exist for any graph
+    int bound = std::max(task.lowerBound, task.sat.lowerBound);
+    if (optimal)
     {
-        std::cout << num << " ";
+        bound = task.optimalCover;
     }
-    std::cout << "\n";
-    double approx_t3 = static_cast<double>(finalResult_Vector_3.size()) / globalOptimalCover;
-    t3_app = t3_app + approx_t3;
-    t3_ratios.push_back(approx_t3);
-    finalResult_Vector_3.clear();
-}
\ No newline at end of file
+    const AlgorithmResult *results[] = {&task.sat, &task.approx1, &task.approx2};
+    for (int i = 0; i < STATS_ALGORITHMS; ++i)
+    {
+        const AlgorithmResult &result = *results[i];
+        double ratio = optimal ? static_cast<double>(result.cover.size()) / task.optimalCover : -1;
+        double boundRatio = bound > 0 ? static_cast<double>(result.cover.size()) / bound : -1;
+        // CNF-SAT-VC is skipped on most vertex counts and printed as a
+        // timeout there; that is no run at all, not a graph that timed out
+        bool ran = i != STATS_SAT || task.runSat;
+        if (!ran)
+        {
+            continue;
+        }
+        runStats.record(task.vertices, static_cast<StatsAlgorithm>(i), result.status == RESULT_TIMEOUT, ratio, boundRatio,
+                        result.cpuMicros, result.wallMicros);
+    }
+}
+
+void printTimingLines(const GraphTask &task)
+{
+    const char *names[] = {"CNF-SAT-VC", "APPROX-VC-1", "APPROX-VC-2"};
+    const AlgorithmResult *results[] = {&task.sat, &task.approx1, &task.approx2};
+    for (int i = 0; i < 3; ++i)
+    {
+        std::cerr << "Timing: V " << task.vertices << " " << names[i]
+                  << " cpu " << static_cast<long long>(results[i]->cpuMicros) << " us"
+                  << " wall " << static_cast<long long>(results[i]->wallMicros) << " us\n";
+    }
+    std::cerr << "Timing: V " << task.vertices << " graph wall " << static_cast<long long>(task.wallMicros) << " us\n";
+}
@@ -0,0 +1,52 @@
+#include "graph.h"
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+CsrGraph::CsrGraph(int v, const std::vector<std::pair<int, int>> &pairVector)
+    : CsrGraph(v, std::vector<std::pair<int, int>>(pairVector))
+{
+}
+
+CsrGraph::CsrGraph(int v, std::vector<std::pair<int, int>> &&edges)
+    : v(v), pairVector(std::move(edges)), offsets(v + 2, 0), neighbors(2 * pairVector.size()), degree(v + 1, 0)
+{
+    for (const auto &pair : pairVector)
+    {
+        ++degree[pair.first];
+        ++degree[pair.second];
+    }
+    for (int i = 1; i <= v; ++i)
+    {
+        offsets[i + 1] = offsets[i] + degree[i];
+    }
+    std::vector<int> fill(offsets.begin(), offsets.end() - 1);
+    for (const auto &pair : pairVector)
+    {
+        neighbors[fill[pair.first]++] = pair.second;
+        neighbors[fill[pair.second]++] = pair.first;
+    }
+}
+
+CsrGraph::CsrGraph(int v, std::vector<std::pair<int, int>> pairVector, std::vector<int> offsets, std::vector<int> neighbors)
+    : v(v), pairVector(std::move(pairVector)), offsets(std::move(offsets)), neighbors(std::move(neighbors)), degree(v + 1, 0)
+{
+    for (int i = 1; i <= v; ++i)
+    {
+        degree[i] = this->offsets[i + 1] - this->offsets[i];
+    }
+}
+
+bool hasDuplicateEdge(const std::vector<std::pair<int, int>> &pairVector)
+{
+    // (smaller << 32 | larger), so <a,b> and <b,a> collide
+    std::vector<uint64_t> keys;
+    keys.reserve(pairVector.size());
+    for (const auto &pair : pairVector)
+    {
+        keys.push_back((static_cast<uint64_t>(std::min(pair.first, pair.second)) << 32) |
+                       static_cast<uint32_t>(std::max(pair.first, pair.second)));
+    }
+    std::sort(keys.begin(), keys.end());
+    return std::adjacent_find(keys.begin(), keys.end()) != keys.end();
+}
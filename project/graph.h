@@ -0,0 +1,30 @@
+#ifndef GRAPH_H
+#define GRAPH_H
+
+#include <vector>
+#include <utility>
+
+// Undirected graph in compressed sparse row form. Built once per E line and
+// shared read-only by every vertex cover algorithm.
+struct CsrGraph
+{
+    CsrGraph(int v, const std::vector<std::pair<int, int>> &pairVector);
+    // Takes over the edge list instead of copying it
+    CsrGraph(int v, std::vector<std::pair<int, int>> &&pairVector);
+    // Adopts arrays that are already in CSR form, as stored in a graph file
+    CsrGraph(int v, std::vector<std::pair<int, int>> pairVector, std::vector<int> offsets, std::vector<int> neighbors);
+
+    int v;
+    // Edges in input order
+    std::vector<std::pair<int, int>> pairVector;
+    // Neighbours of vertex i are neighbors[offsets[i] .. offsets[i + 1])
+    std::vector<int> offsets;
+    std::vector<int> neighbors;
+    std::vector<int> degree;
+};
+
+// True if some edge appears twice, in either direction. Sorts a packed copy
+// of the endpoints, so it needs 8 bytes per edge for as long as it runs.
+bool hasDuplicateEdge(const std::vector<std::pair<int, int>> &pairVector);
+
+#endif
@@ -0,0 +1,192 @@
+#include "graph_file.h"
+#include <cstring>
+#include <utility>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+uint64_t graphChecksum(const char *data, size_t size)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+bool writeGraph(std::FILE *out, const CsrGraph &graph, bool checksum)
+{
+    std::vector<int32_t> body;
+    body.reserve(4 * graph.pairVector.size() + graph.offsets.size());
+    for (const auto &pair : graph.pairVector)
+    {
+        body.push_back(pair.first);
+        body.push_back(pair.second);
+    }
+    body.insert(body.end(), graph.offsets.begin(), graph.offsets.end());
+    body.insert(body.end(), graph.neighbors.begin(), graph.neighbors.end());
+
+    GraphFileHeader header;
+    std::memcpy(header.magic, GRAPH_FILE_MAGIC, sizeof(header.magic));
+    header.flags = checksum ? GRAPH_FILE_CHECKSUM : 0;
+    header.v = graph.v;
+    header.edges = graph.pairVector.size();
+    header.checksum = 0;
+    if (checksum)
+    {
+        header.checksum = graphChecksum(reinterpret_cast<const char *>(body.data()), body.size() * sizeof(int32_t));
+    }
+    return std::fwrite(&header, sizeof(header), 1, out) == 1 &&
+           std::fwrite(body.data(), sizeof(int32_t), body.size(), out) == body.size();
+}
+
+GraphFileReader::GraphFileReader()
+    : mapped(nullptr), mappedSize(0), position(0), opened(false), bad(false)
+{
+}
+
+GraphFileReader::~GraphFileReader()
+{
+    if (mapped != nullptr)
+    {
+        munmap(mapped, mappedSize);
+    }
+}
+
+bool GraphFileReader::open(const std::string &path)
+{
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0)
+    {
+        close(fd);
+        return false;
+    }
+    if (info.st_size > 0)
+    {
+        void *address = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (address == MAP_FAILED)
+        {
+            close(fd);
+            return false;
+        }
+        mapped = static_cast<char *>(address);
+        mappedSize = info.st_size;
+        madvise(mapped, mappedSize, MADV_SEQUENTIAL);
+    }
+    close(fd);
+    opened = true;
+    return true;
+}
+
+bool GraphFileReader::isOpen() const
+{
+    return opened;
+}
+
+bool GraphFileReader::corrupt() const
+{
+    return bad;
+}
+
+bool GraphFileReader::next(std::unique_ptr<const CsrGraph> &graph)
+{
+    if (bad || position == mappedSize)
+    {
+        return false;
+    }
+    bad = true;
+    GraphFileHeader header;
+    if (mappedSize - position < sizeof(header))
+    {
+        return false;
+    }
+    std::memcpy(&header, mapped + position, sizeof(header));
+    uint64_t count = 4 * static_cast<uint64_t>(header.edges) + header.v + 2;
+    if (std::memcmp(header.magic, GRAPH_FILE_MAGIC, sizeof(header.magic)) != 0 ||
+        header.v > INT32_MAX / 2 || header.edges > INT32_MAX / 2 ||
+        (mappedSize - position - sizeof(header)) / sizeof(int32_t) < count)
+    {
+        return false;
+    }
+    const char *data = mapped + position + sizeof(header);
+    if ((header.flags & GRAPH_FILE_CHECKSUM) && graphChecksum(data, count * sizeof(int32_t)) != header.checksum)
+    {
+        return false;
+    }
+
+    // CsrGraph owns its arrays, so they are copied out of the mapping once;
+    // the structure is checked before any algorithm indexes with it
+    int v = header.v;
+    int edges = header.edges;
+    std::vector<std::pair<int, int>> pairVector(edges);
+    std::vector<int> offsets(v + 2);
+    std::vector<int> neighbors(2 * edges);
+    for (auto &pair : pairVector)
+    {
+        std::memcpy(&pair.first, data, sizeof(int32_t));
+        std::memcpy(&pair.second, data + sizeof(int32_t), sizeof(int32_t));
+        data += 2 * sizeof(int32_t);
+    }
+    std::memcpy(offsets.data(), data, offsets.size() * sizeof(int32_t));
+    data += offsets.size() * sizeof(int32_t);
+    std::memcpy(neighbors.data(), data, neighbors.size() * sizeof(int32_t));
+
+    if (offsets[0] != 0 || offsets[1] != 0 || offsets[v + 1] != 2 * edges)
+    {
+        return false;
+    }
+    for (int i = 1; i <= v; ++i)
+    {
+        if (offsets[i + 1] < offsets[i])
+        {
+            return false;
+        }
+    }
+    // Only a simple graph laid out exactly as CsrGraph builds it is accepted:
+    // walking the edges in order must fill each neighbor slice slot by slot.
+    // The slices hold 2 * edges slots in total, so none is left over after
+    for (const auto &pair : pairVector)
+    {
+        if (pair.first < 1 || pair.first > v || pair.second < 1 || pair.second > v || pair.first == pair.second)
+        {
+            return false;
+        }
+    }
+    std::vector<int> fill(offsets.begin(), offsets.end() - 1);
+    for (const auto &pair : pairVector)
+    {
+        int &first = fill[pair.first];
+        int &second = fill[pair.second];
+        if (first == offsets[pair.first + 1] || neighbors[first++] != pair.second ||
+            second == offsets[pair.second + 1] || neighbors[second++] != pair.first)
+        {
+            return false;
+        }
+    }
+    // A repeated neighbor means the same edge, in either direction, twice
+    std::vector<int> seen(v + 1, 0);
+    for (int i = 1; i <= v; ++i)
+    {
+        for (int k = offsets[i]; k < offsets[i + 1]; ++k)
+        {
+            if (seen[neighbors[k]] == i)
+            {
+                return false;
+            }
+            seen[neighbors[k]] = i;
+        }
+    }
+
+    graph.reset(new CsrGraph(v, std::move(pairVector), std::move(offsets), std::move(neighbors)));
+    position += sizeof(header) + count * sizeof(int32_t);
+    bad = false;
+    return true;
+}
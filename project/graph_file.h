@@ -0,0 +1,61 @@
+#ifndef GRAPH_FILE_H
+#define GRAPH_FILE_H
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include "graph.h"
+
+// Binary graph file: a sequence of records, one per graph, each laid out as
+//   GraphFileHeader
+//   int32 pairs[2 * edges]        edge list in input order
+//   int32 offsets[v + 2]          CsrGraph::offsets
+//   int32 neighbors[2 * edges]    CsrGraph::neighbors
+// in native byte order. Everything the algorithms need is stored, so loading
+// a graph is a copy and one validation pass instead of parsing and
+// rebuilding. A record is rejected as corrupt unless it is a simple graph
+// (no self-loops, no edge twice in either direction) whose offsets and
+// neighbors are exactly what CsrGraph builds from its edge list.
+struct GraphFileHeader
+{
+    char magic[4];
+    uint32_t flags;
+    uint32_t v;
+    uint32_t edges;
+    // FNV-1a over the three arrays when GRAPH_FILE_CHECKSUM is set, else 0
+    uint64_t checksum;
+};
+
+const char GRAPH_FILE_MAGIC[4] = {'V', 'C', 'G', '1'};
+const uint32_t GRAPH_FILE_CHECKSUM = 1;
+
+uint64_t graphChecksum(const char *data, size_t size);
+// Appends one record for graph to out
+bool writeGraph(std::FILE *out, const CsrGraph &graph, bool checksum);
+
+// Reads the records of a memory-mapped graph file one at a time
+class GraphFileReader
+{
+public:
+    GraphFileReader();
+    ~GraphFileReader();
+
+    bool open(const std::string &path);
+    bool isOpen() const;
+    // False at the end of the file or at the first bad record, see corrupt()
+    bool next(std::unique_ptr<const CsrGraph> &graph);
+    bool corrupt() const;
+
+private:
+    GraphFileReader(const GraphFileReader &);
+    GraphFileReader &operator=(const GraphFileReader &);
+
+    char *mapped;
+    size_t mappedSize;
+    size_t position;
+    bool opened;
+    bool bad;
+};
+
+#endif
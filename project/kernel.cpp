@@ -0,0 +1,209 @@
+#include "kernel.h"
+#include <algorithm>
+
+Kernel::Kernel(int v, const std::vector<std::pair<int, int>> &pairVector)
+    : v(0), adjacency(v + 1), removed(v + 1, false), label(1)
+{
+    for (const auto &pair : pairVector)
+    {
+        adjacency[pair.first].insert(pair.second);
+        adjacency[pair.second].insert(pair.first);
+    }
+
+    // Cheap local rules first; the loop restarts whenever one of them fires
+    while (pendantRule() || foldRule() || dominanceRule() || bussRule())
+    {
+    }
+
+    std::vector<int> index(adjacency.size(), 0);
+    for (int i = 1; i < static_cast<int>(adjacency.size()); ++i)
+    {
+        if (!removed[i] && !adjacency[i].empty())
+        {
+            index[i] = label.size();
+            label.push_back(i);
+        }
+    }
+    this->v = label.size() - 1;
+    for (int i = 1; i <= this->v; ++i)
+    {
+        for (int neighbor : adjacency[label[i]])
+        {
+            if (index[neighbor] > i)
+            {
+                this->pairVector.emplace_back(i, index[neighbor]);
+            }
+        }
+    }
+}
+
+void Kernel::take(int vertex)
+{
+    forced.emplace_back(vertex);
+    remove(vertex);
+}
+
+void Kernel::remove(int vertex)
+{
+    for (int neighbor : adjacency[vertex])
+    {
+        adjacency[neighbor].erase(vertex);
+    }
+    adjacency[vertex].clear();
+    removed[vertex] = true;
+}
+
+bool Kernel::pendantRule()
+{
+    bool changed = false;
+    for (int i = 1; i < static_cast<int>(adjacency.size()); ++i)
+    {
+        if (removed[i])
+        {
+            continue;
+        }
+        if (adjacency[i].empty())
+        {
+            removed[i] = true;
+        }
+        else if (adjacency[i].size() == 1)
+        {
+            // Some cover of minimum size contains the neighbour of a pendant
+            take(*adjacency[i].begin());
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+bool Kernel::foldRule()
+{
+    bool changed = false;
+    for (int i = 1; i < static_cast<int>(adjacency.size()); ++i)
+    {
+        if (removed[i] || adjacency[i].size() != 2)
+        {
+            continue;
+        }
+        int a = *adjacency[i].begin();
+        int b = *adjacency[i].rbegin();
+        changed = true;
+        if (adjacency[a].count(b))
+        {
+            // Triangle: both neighbours are in some minimum cover
+            take(a);
+            take(b);
+            continue;
+        }
+
+        // Either u or both a and b are in a minimum cover, so a, b and u are
+        // replaced by one vertex f adjacent to N(a) and N(b) and OPT drops by 1
+        std::set<int> neighbors(adjacency[a]);
+        neighbors.insert(adjacency[b].begin(), adjacency[b].end());
+        neighbors.erase(i);
+        remove(i);
+        remove(a);
+        remove(b);
+
+        int f = adjacency.size();
+        adjacency.emplace_back(neighbors);
+        removed.push_back(false);
+        for (int neighbor : neighbors)
+        {
+            adjacency[neighbor].insert(f);
+        }
+        folds.push_back({i, a, b, f});
+    }
+    return changed;
+}
+
+bool Kernel::dominanceRule()
+{
+    bool changed = false;
+    for (int u = 1; u < static_cast<int>(adjacency.size()); ++u)
+    {
+        if (removed[u])
+        {
+            continue;
+        }
+        // If N[u] is contained in N[w] for a neighbour w, w is in a minimum cover
+        for (int w : adjacency[u])
+        {
+            if (adjacency[w].size() < adjacency[u].size())
+            {
+                continue;
+            }
+            bool dominates = std::all_of(adjacency[u].begin(), adjacency[u].end(), [&](int n)
+                                         { return n == w || adjacency[w].count(n); });
+            if (dominates)
+            {
+                take(w);
+                changed = true;
+                break;
+            }
+        }
+    }
+    return changed;
+}
+
+bool Kernel::bussRule()
+{
+    // The endpoints of a maximal matching give an upper bound on OPT of what
+    // is left; a vertex with more neighbours than that must be in every
+    // minimum cover, since leaving it out would need all of them instead.
+    std::vector<bool> matched(adjacency.size(), false);
+    int upper = 0;
+    for (int u = 1; u < static_cast<int>(adjacency.size()); ++u)
+    {
+        for (int w : adjacency[u])
+        {
+            if (!matched[u] && !matched[w])
+            {
+                matched[u] = true;
+                matched[w] = true;
+                upper += 2;
+            }
+        }
+    }
+
+    bool changed = false;
+    for (int u = 1; u < static_cast<int>(adjacency.size()); ++u)
+    {
+        if (!removed[u] && static_cast<int>(adjacency[u].size()) > upper)
+        {
+            take(u);
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+std::vector<int> Kernel::lift(const std::vector<int> &kernelCover) const
+{
+    std::set<int> cover(forced.begin(), forced.end());
+    for (int vertex : kernelCover)
+    {
+        cover.insert(label[vertex]);
+    }
+
+    // Undo folds newest first, since a fold vertex can itself have been folded
+    for (auto it = folds.rbegin(); it != folds.rend(); ++it)
+    {
+        if (cover.erase(it->f))
+        {
+            cover.insert(it->a);
+            cover.insert(it->b);
+        }
+        else
+        {
+            cover.insert(it->u);
+        }
+    }
+    return std::vector<int>(cover.begin(), cover.end());
+}
+
+int Kernel::coverOffset() const
+{
+    // Every forced vertex, plus u or both a and b in place of f for every fold
+    return forced.size() + folds.size();
+}
@@ -0,0 +1,54 @@
+#ifndef KERNEL_H
+#define KERNEL_H
+
+#include <vector>
+#include <set>
+#include <utility>
+
+// Vertex cover kernelization. Repeatedly applies degree-0 removal, the
+// degree-1 pendant rule, degree-2 folding, dominance and Buss's high-degree
+// rule, recording every vertex the rules force into the cover. What is left
+// is relabelled to 1..v and handed to the algorithms; lift() turns a cover
+// of that kernel back into a cover of the original graph.
+class Kernel
+{
+public:
+    Kernel(int v, const std::vector<std::pair<int, int>> &pairVector);
+
+    // Kernel vertex count and edges, vertices numbered 1..v
+    int v;
+    std::vector<std::pair<int, int>> pairVector;
+
+    // Maps a cover of the kernel to a cover of the original graph. An
+    // optimal kernel cover lifts to an optimal cover.
+    std::vector<int> lift(const std::vector<int> &kernelCover) const;
+    // Vertices lift() adds to any kernel cover, so OPT = kernel OPT + coverOffset()
+    int coverOffset() const;
+
+private:
+    // Vertex u of degree 2 with non-adjacent neighbours a and b, merged into f
+    struct Fold
+    {
+        int u;
+        int a;
+        int b;
+        int f;
+    };
+
+    void take(int vertex);
+    void remove(int vertex);
+    bool pendantRule();
+    bool foldRule();
+    bool dominanceRule();
+    bool bussRule();
+
+    // adjacency[i]: neighbours of vertex i, ids past the input vertices are folds
+    std::vector<std::set<int>> adjacency;
+    std::vector<bool> removed;
+    std::vector<int> forced;
+    std::vector<Fold> folds;
+    // label[i]: original (or fold) id of kernel vertex i
+    std::vector<int> label;
+};
+
+#endif
@@ -0,0 +1,99 @@
+#include "line_reader.h"
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+LineReader::LineReader()
+    : stdinLines(0), fromFile(false), mapped(nullptr), mappedSize(0), cursor(nullptr), last(nullptr), finished(false),
+      lineBegin(nullptr), lineEnd(nullptr), lineTaken(true)
+{
+}
+
+LineReader::~LineReader()
+{
+    if (mapped != nullptr)
+    {
+        munmap(mapped, mappedSize);
+    }
+}
+
+bool LineReader::open(const std::string &path)
+{
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0)
+    {
+        close(fd);
+        return false;
+    }
+
+    // An empty file cannot be mapped, it simply has no lines past the first
+    if (info.st_size > 0)
+    {
+        void *address = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (address == MAP_FAILED)
+        {
+            close(fd);
+            return false;
+        }
+        mapped = static_cast<char *>(address);
+        mappedSize = info.st_size;
+        // Read once front to back: ask for aggressive read-ahead and early reuse
+        madvise(mapped, mappedSize, MADV_SEQUENTIAL);
+    }
+    // The mapping keeps the file referenced on its own
+    close(fd);
+    fromFile = true;
+    cursor = mapped;
+    last = mapped + mappedSize;
+    return true;
+}
+
+bool LineReader::nextLine()
+{
+    if (!fromFile)
+    {
+        return stdinLines.nextLine();
+    }
+    if (finished)
+    {
+        return false;
+    }
+
+    const void *newline = cursor == last ? nullptr : std::memchr(cursor, '\n', last - cursor);
+    lineBegin = cursor;
+    if (newline == nullptr)
+    {
+        lineEnd = last;
+        finished = true;
+    }
+    else
+    {
+        lineEnd = static_cast<const char *>(newline);
+        cursor = lineEnd + 1;
+    }
+    lineTaken = false;
+    return true;
+}
+
+bool LineReader::nextPiece(const char *&begin, const char *&end)
+{
+    if (!fromFile)
+    {
+        return stdinLines.nextPiece(begin, end);
+    }
+    if (lineTaken)
+    {
+        return false;
+    }
+    begin = lineBegin;
+    end = lineEnd;
+    lineTaken = true;
+    return true;
+}
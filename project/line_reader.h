@@ -0,0 +1,45 @@
+#ifndef LINE_READER_H
+#define LINE_READER_H
+
+#include <cstddef>
+#include <string>
+#include "graph_parser.h"
+#include "line_stream.h"
+
+// Hands out input lines one at a time for a CommandScanner to read. Streams
+// stdin through a fixed-size buffer by default; after open() it walks a
+// read-only mapping of the file instead, where each line is a single piece
+// parsed in place. Either way no line is ever copied whole, and the last
+// line is whatever follows the final '\n', exactly like a while (!eof)
+// getline loop.
+class LineReader : public LineSource
+{
+public:
+    LineReader();
+    ~LineReader();
+
+    // Maps path for reading; false if it cannot be opened or mapped
+    bool open(const std::string &path);
+    // Moves on to the next line; false once the input is used up
+    bool nextLine();
+    bool nextPiece(const char *&begin, const char *&end);
+
+private:
+    LineReader(const LineReader &);
+    LineReader &operator=(const LineReader &);
+
+    StreamLineReader stdinLines;
+    bool fromFile;
+    char *mapped;
+    size_t mappedSize;
+    // Start of the next line in the mapping, and the end of the mapping
+    const char *cursor;
+    const char *last;
+    bool finished;
+    // The current mapped line, until nextPiece() has handed it out
+    const char *lineBegin;
+    const char *lineEnd;
+    bool lineTaken;
+};
+
+#endif
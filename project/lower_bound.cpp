@@ -0,0 +1,171 @@
+#include "lower_bound.h"
+#include <algorithm>
+#include <climits>
+
+int LowerBounds::best() const
+{
+    return std::max({matching, cliqueCover, lp});
+}
+
+int matchingLowerBound(const CsrGraph &graph)
+{
+    std::vector<bool> matched(graph.v + 1, false);
+    int size = 0;
+    for (const auto &pair : graph.pairVector)
+    {
+        if (!matched[pair.first] && !matched[pair.second])
+        {
+            matched[pair.first] = true;
+            matched[pair.second] = true;
+            ++size;
+        }
+    }
+    return size;
+}
+
+int cliqueCoverLowerBound(const CsrGraph &graph)
+{
+    // A cover misses at most one vertex of every clique
+    std::vector<bool> assigned(graph.v + 1, false);
+    // adjacent[w] == stamp: w is a neighbour of the vertex added last
+    std::vector<int> adjacent(graph.v + 1, 0);
+    std::vector<int> candidates;
+    int cliques = 0;
+    for (int u = 1; u <= graph.v; ++u)
+    {
+        if (assigned[u])
+        {
+            continue;
+        }
+        assigned[u] = true;
+        ++cliques;
+
+        // Candidates stay adjacent to every vertex of the clique so far
+        candidates.clear();
+        for (int i = graph.offsets[u]; i < graph.offsets[u + 1]; ++i)
+        {
+            if (!assigned[graph.neighbors[i]])
+            {
+                candidates.emplace_back(graph.neighbors[i]);
+            }
+        }
+        while (!candidates.empty())
+        {
+            int w = candidates.back();
+            candidates.pop_back();
+            assigned[w] = true;
+            for (int i = graph.offsets[w]; i < graph.offsets[w + 1]; ++i)
+            {
+                adjacent[graph.neighbors[i]] = w;
+            }
+            candidates.erase(std::remove_if(candidates.begin(), candidates.end(), [&](int c)
+                                            { return adjacent[c] != w; }),
+                             candidates.end());
+        }
+    }
+    return graph.v - cliques;
+}
+
+int lpLowerBound(const CsrGraph &graph)
+{
+    int v = graph.v;
+    const std::vector<int> &offsets = graph.offsets;
+    const std::vector<int> &neighbors = graph.neighbors;
+    // matchLeft[u]: right vertex matched to left u, 0 if free; matchRight likewise
+    std::vector<int> matchLeft(v + 1, 0);
+    std::vector<int> matchRight(v + 1, 0);
+    std::vector<int> dist(v + 1);
+    std::vector<int> next(v + 1);
+    // via[u]: right vertex the augmenting path leaves left vertex u through
+    std::vector<int> via(v + 1);
+    std::vector<int> queue;
+    std::vector<int> path;
+    int size = 0;
+    while (true)
+    {
+        // Layer the left vertices by alternating-path distance from a free one
+        queue.clear();
+        for (int u = 1; u <= v; ++u)
+        {
+            dist[u] = matchLeft[u] == 0 ? 0 : INT_MAX;
+            if (matchLeft[u] == 0)
+            {
+                queue.emplace_back(u);
+            }
+        }
+        bool reachedFree = false;
+        for (size_t head = 0; head < queue.size(); ++head)
+        {
+            int u = queue[head];
+            for (int i = offsets[u]; i < offsets[u + 1]; ++i)
+            {
+                int partner = matchRight[neighbors[i]];
+                if (partner == 0)
+                {
+                    reachedFree = true;
+                }
+                else if (dist[partner] == INT_MAX)
+                {
+                    dist[partner] = dist[u] + 1;
+                    queue.emplace_back(partner);
+                }
+            }
+        }
+        if (!reachedFree)
+        {
+            break;
+        }
+
+        // Vertex-disjoint shortest augmenting paths along the layers, with an
+        // explicit stack since paths can be as long as the graph
+        for (int u = 1; u <= v; ++u)
+        {
+            next[u] = offsets[u];
+        }
+        for (int start = 1; start <= v; ++start)
+        {
+            if (matchLeft[start] != 0)
+            {
+                continue;
+            }
+            path.assign(1, start);
+            while (!path.empty())
+            {
+                int u = path.back();
+                if (next[u] == offsets[u + 1])
+                {
+                    // Dead end for the rest of this phase
+                    dist[u] = INT_MAX;
+                    path.pop_back();
+                    continue;
+                }
+                int w = neighbors[next[u]++];
+                int partner = matchRight[w];
+                if (partner != 0 && dist[partner] != dist[u] + 1)
+                {
+                    continue;
+                }
+                via[u] = w;
+                if (partner != 0)
+                {
+                    path.emplace_back(partner);
+                    continue;
+                }
+                for (int x : path)
+                {
+                    matchLeft[x] = via[x];
+                    matchRight[via[x]] = x;
+                }
+                ++size;
+                break;
+            }
+        }
+    }
+    // The LP optimum is size / 2; an integral cover needs at least its ceiling
+    return (size + 1) / 2;
+}
+
+LowerBounds computeLowerBounds(const CsrGraph &graph)
+{
+    return {matchingLowerBound(graph), cliqueCoverLowerBound(graph), lpLowerBound(graph)};
+}
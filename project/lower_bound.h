@@ -0,0 +1,29 @@
+#ifndef LOWER_BOUND_H
+#define LOWER_BOUND_H
+
+#include "graph.h"
+
+// Lower bounds on the minimum vertex cover that take near-linear time, so
+// the approximations can be rated on graphs far too large for CNF-SAT-VC
+struct LowerBounds
+{
+    // Edges of a maximal matching; each needs a cover vertex of its own
+    int matching;
+    // Sum of |C| - 1 over a greedy partition of the vertices into cliques
+    int cliqueCover;
+    // Optimum of the LP relaxation, rounded up
+    int lp;
+
+    int best() const;
+};
+
+int matchingLowerBound(const CsrGraph &graph);
+int cliqueCoverLowerBound(const CsrGraph &graph);
+// The LP optimum is half the maximum matching of the bipartite double cover
+// (u on the left joined to w on the right for every edge uw), found with
+// Hopcroft-Karp in O(E sqrt V)
+int lpLowerBound(const CsrGraph &graph);
+
+LowerBounds computeLowerBounds(const CsrGraph &graph);
+
+#endif
@@ -0,0 +1,529 @@
+#include "sat_vc.h"
+#include <algorithm>
+#include <memory>
+
+using namespace Minisat;
+
+void HintedSolver::prefer(Var v, bool value)
+{
+    // MiniSat's polarity is the sign of the decision literal, true for ~v
+    setPolarity(v, !value);
+    varBumpActivity(v, var_inc);
+}
+
+VertexCoverSat::VertexCoverSat()
+    : active(nullptr), stopped(false)
+{
+    pthread_mutex_init(&mutex, nullptr);
+}
+
+VertexCoverSat::~VertexCoverSat()
+{
+    pthread_mutex_destroy(&mutex);
+}
+
+void VertexCoverSat::interrupt()
+{
+    pthread_mutex_lock(&mutex);
+    stopped = true;
+    if (active != nullptr)
+    {
+        active->interrupt();
+    }
+    pthread_mutex_unlock(&mutex);
+}
+
+bool VertexCoverSat::interrupted()
+{
+    pthread_mutex_lock(&mutex);
+    bool result = stopped;
+    pthread_mutex_unlock(&mutex);
+    return result;
+}
+
+void VertexCoverSat::setHint(const std::vector<int> &cover)
+{
+    // Ascending, so the hinted positions also respect orderPositions
+    hint = cover;
+    std::sort(hint.begin(), hint.end());
+}
+
+lbool VertexCoverSat::solve(Solver &solver, const vec<Lit> &assumptions)
+{
+    pthread_mutex_lock(&mutex);
+    if (stopped)
+    {
+        pthread_mutex_unlock(&mutex);
+        return l_Undef;
+    }
+    active = &solver;
+    pthread_mutex_unlock(&mutex);
+
+    // No budget is set, so only interrupt() makes this return l_Undef
+    solver.budgetOff();
+    lbool result = solver.solveLimited(assumptions);
+
+    pthread_mutex_lock(&mutex);
+    active = nullptr;
+    pthread_mutex_unlock(&mutex);
+    return result;
+}
+
+RebuildVertexCoverSat::RebuildVertexCoverSat(int v, const std::vector<std::pair<int, int>> &pairVector, bool orderPositions)
+    : v(v), pairVector(pairVector), orderPositions(orderPositions)
+{
+}
+
+bool RebuildVertexCoverSat::solveForK(int k, std::vector<int> &cover)
+{
+    std::unique_ptr<HintedSolver> solver(new HintedSolver());
+    std::vector<std::vector<Lit>> literals_2d(v + 1, std::vector<Lit>(k + 1));
+    for (int i = 1; i <= v; ++i)
+    {
+        for (int j = 1; j <= k; ++j)
+        {
+            literals_2d[i][j] = mkLit(solver->newVar());
+        }
+    }
+    for (int j = 1; j <= k && j <= static_cast<int>(hint.size()); ++j)
+    {
+        solver->prefer(var(literals_2d[hint[j - 1]][j]), true);
+    }
+    for (int vertex = 1; vertex <= k; ++vertex)
+    {
+        vec<Lit> clause;
+        for (int n = 1; n <= v; ++n)
+        {
+            clause.push(literals_2d[n][vertex]);
+        }
+        solver->addClause(clause);
+    }
+    for (int n = 1; n <= v; ++n)
+    {
+        for (int vertex1 = 1; vertex1 <= k; ++vertex1)
+        {
+            for (int vertex2 = vertex1 + 1; vertex2 <= k; ++vertex2)
+            {
+                solver->addClause(~literals_2d[n][vertex1], ~literals_2d[n][vertex2]);
+            }
+        }
+    }
+    for (int vertex = 1; vertex <= k; ++vertex)
+    {
+        for (int n1 = 1; n1 <= v; ++n1)
+        {
+            for (int n2 = n1 + 1; n2 <= v; ++n2)
+            {
+                solver->addClause(~literals_2d[n1][vertex], ~literals_2d[n2][vertex]);
+            }
+        }
+    }
+    for (const auto &pair : pairVector)
+    {
+        vec<Lit> clause;
+        for (int vertex = 1; vertex <= k; ++vertex)
+        {
+            clause.push(literals_2d[pair.first][vertex]);
+        }
+        for (int vertex = 1; vertex <= k; ++vertex)
+        {
+            clause.push(literals_2d[pair.second][vertex]);
+        }
+        solver->addClause(clause);
+    }
+    if (orderPositions)
+    {
+        for (int vertex = 1; vertex < k; ++vertex)
+        {
+            for (int n = 1; n <= v; ++n)
+            {
+                vec<Lit> clause;
+                clause.push(~literals_2d[n][vertex + 1]);
+                for (int smaller = 1; smaller < n; ++smaller)
+                {
+                    clause.push(literals_2d[smaller][vertex]);
+                }
+                solver->addClause(clause);
+            }
+        }
+    }
+
+    if (solve(*solver, vec<Lit>()) != l_True)
+    {
+        return false;
+    }
+
+    cover.clear();
+    for (int i = 1; i <= v; ++i)
+    {
+        for (int j = 1; j <= k; ++j)
+        {
+            if (solver->modelValue(literals_2d[i][j]) == l_True)
+            {
+                cover.emplace_back(i);
+            }
+        }
+    }
+    return true;
+}
+
+IncrementalVertexCoverSat::IncrementalVertexCoverSat(int v, const std::vector<std::pair<int, int>> &pairVector, bool orderPositions)
+    : v(v), pairVector(pairVector), orderPositions(orderPositions), literals_2d(v + 1, std::vector<Lit>(1)), positionUsed(1), edgeGuard(lit_Undef), edgePositions(0)
+{
+}
+
+void IncrementalVertexCoverSat::addPosition()
+{
+    int position = positionUsed.size();
+    Lit used = mkLit(solver.newVar());
+    positionUsed.push_back(used);
+
+    for (int i = 1; i <= v; ++i)
+    {
+        literals_2d[i].push_back(mkLit(solver.newVar()));
+    }
+    if (position <= static_cast<int>(hint.size()))
+    {
+        solver.prefer(var(literals_2d[hint[position - 1]][position]), true);
+    }
+
+    // An unused position holds no vertex, a used one holds at least one
+    vec<Lit> clause;
+    clause.push(~used);
+    for (int n = 1; n <= v; ++n)
+    {
+        solver.addClause(~literals_2d[n][position], used);
+        clause.push(literals_2d[n][position]);
+    }
+    solver.addClause(clause);
+
+    // No vertex appears at this and any earlier position
+    for (int n = 1; n <= v; ++n)
+    {
+        for (int earlier = 1; earlier < position; ++earlier)
+        {
+            solver.addClause(~literals_2d[n][earlier], ~literals_2d[n][position]);
+        }
+    }
+
+    // No two vertices share this position
+    for (int n1 = 1; n1 <= v; ++n1)
+    {
+        for (int n2 = n1 + 1; n2 <= v; ++n2)
+        {
+            solver.addClause(~literals_2d[n1][position], ~literals_2d[n2][position]);
+        }
+    }
+
+    // The vertex here has a larger index than the one at the previous position
+    if (orderPositions && position > 1)
+    {
+        for (int n = 1; n <= v; ++n)
+        {
+            vec<Lit> clause;
+            clause.push(~literals_2d[n][position]);
+            for (int smaller = 1; smaller < n; ++smaller)
+            {
+                clause.push(literals_2d[smaller][position - 1]);
+            }
+            solver.addClause(clause);
+        }
+    }
+}
+
+void IncrementalVertexCoverSat::addEdgeClauses()
+{
+    // The previous generation only spans the old positions and is stronger
+    // than the new one, so it is switched off for good.
+    if (edgeGuard != lit_Undef)
+    {
+        solver.addClause(~edgeGuard);
+    }
+    edgeGuard = mkLit(solver.newVar());
+    edgePositions = positionUsed.size() - 1;
+
+    for (const auto &pair : pairVector)
+    {
+        vec<Lit> clause;
+        clause.push(~edgeGuard);
+        for (int position = 1; position <= edgePositions; ++position)
+        {
+            clause.push(literals_2d[pair.first][position]);
+            clause.push(literals_2d[pair.second][position]);
+        }
+        solver.addClause(clause);
+    }
+}
+
+bool IncrementalVertexCoverSat::solveForK(int k, std::vector<int> &cover)
+{
+    while (static_cast<int>(positionUsed.size()) <= k)
+    {
+        addPosition();
+    }
+    if (edgePositions != static_cast<int>(positionUsed.size()) - 1)
+    {
+        addEdgeClauses();
+    }
+
+    vec<Lit> assumptions;
+    assumptions.push(edgeGuard);
+    for (int position = 1; position <= edgePositions; ++position)
+    {
+        assumptions.push(position <= k ? positionUsed[position] : ~positionUsed[position]);
+    }
+
+    if (solve(solver, assumptions) != l_True)
+    {
+        return false;
+    }
+
+    cover.clear();
+    for (int i = 1; i <= v; ++i)
+    {
+        for (int j = 1; j <= k; ++j)
+        {
+            if (solver.modelValue(literals_2d[i][j]) == l_True)
+            {
+                cover.emplace_back(i);
+                break;
+            }
+        }
+    }
+    std::sort(cover.begin(), cover.end());
+    return true;
+}
+
+bool findMinimumCover(VertexCoverSat &sat, SatSearch search, int v,
+                      const std::vector<std::pair<int, int>> &pairVector,
+                      const std::function<bool()> &deadlineReached,
+                      std::vector<int> &cover, int &lower)
+{
+    // The endpoints of a maximal matching M form a cover, and every cover
+    // needs at least one endpoint of each matched edge.
+    std::vector<bool> matched(v + 1, false);
+    std::vector<int> matching;
+    for (const auto &pair : pairVector)
+    {
+        if (!matched[pair.first] && !matched[pair.second])
+        {
+            matched[pair.first] = true;
+            matched[pair.second] = true;
+            matching.emplace_back(pair.first);
+            matching.emplace_back(pair.second);
+        }
+    }
+    lower = std::max<int>(lower, matching.size() / 2);
+    if (cover.empty() || matching.size() < cover.size())
+    {
+        std::sort(matching.begin(), matching.end());
+        cover.swap(matching);
+    }
+    int upper = cover.size();
+
+    // A satisfiable k lowers upper to the size of the cover found, an
+    // unsatisfiable one raises lower past k; l_Undef once the search must stop
+    std::vector<int> found;
+    auto probe = [&](int k)
+    {
+        if (deadlineReached())
+        {
+            return l_Undef;
+        }
+        if (sat.solveForK(k, found))
+        {
+            upper = found.size();
+            cover.swap(found);
+            return l_True;
+        }
+        if (sat.interrupted())
+        {
+            return l_Undef;
+        }
+        lower = k + 1;
+        return l_False;
+    };
+
+    if (search == SEARCH_GALLOPING)
+    {
+        // Probe upper-1, upper-3, upper-7, ... until the first UNSAT answer
+        int step = 1;
+        while (lower < upper)
+        {
+            lbool answer = probe(std::max(lower, upper - step));
+            if (answer == l_Undef)
+            {
+                return false;
+            }
+            if (answer == l_False)
+            {
+                break;
+            }
+            step *= 2;
+        }
+    }
+
+    // Linear search walks up from the lower bound, so its first SAT answer
+    // closes the interval; binary search bisects it
+    while (lower < upper)
+    {
+        int k = search == SEARCH_LINEAR ? lower : lower + (upper - lower) / 2;
+        if (probe(k) == l_Undef)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+CardinalityVertexCoverSat::CardinalityVertexCoverSat(int v, const std::vector<std::pair<int, int>> &pairVector, SatEncoding encoding)
+    : v(v), encoding(encoding), vertexLit(v + 1, lit_Undef), root(-1)
+{
+    for (const auto &pair : pairVector)
+    {
+        for (int vertex : {pair.first, pair.second})
+        {
+            if (vertexLit[vertex] == lit_Undef)
+            {
+                vertexLit[vertex] = mkLit(solver.newVar());
+                inputs.push_back(vertexLit[vertex]);
+            }
+        }
+        solver.addClause(vertexLit[pair.first], vertexLit[pair.second]);
+    }
+
+    if (encoding == ENCODING_TOTALIZER && !inputs.empty())
+    {
+        root = buildTotalizer(0, inputs.size());
+    }
+    else
+    {
+        counter.resize(inputs.size());
+    }
+}
+
+void CardinalityVertexCoverSat::widenCounter(int width)
+{
+    int n = inputs.size();
+    for (int j = counter[0].size() + 1; j <= width; ++j)
+    {
+        for (int i = 0; i < n; ++i)
+        {
+            Lit out = mkLit(solver.newVar());
+            counter[i].push_back(out);
+            if (j == 1)
+            {
+                solver.addClause(~inputs[i], out);
+            }
+            if (i > 0)
+            {
+                solver.addClause(~counter[i - 1][j - 1], out);
+                if (j > 1)
+                {
+                    solver.addClause(~inputs[i], ~counter[i - 1][j - 2], out);
+                }
+            }
+        }
+    }
+}
+
+int CardinalityVertexCoverSat::buildTotalizer(int begin, int end)
+{
+    TotalizerNode node;
+    node.size = end - begin;
+    node.left = -1;
+    node.right = -1;
+    if (node.size == 1)
+    {
+        node.outputs.push_back(inputs[begin]);
+    }
+    else
+    {
+        int middle = begin + node.size / 2;
+        node.left = buildTotalizer(begin, middle);
+        node.right = buildTotalizer(middle, end);
+    }
+    tree.push_back(node);
+    return tree.size() - 1;
+}
+
+void CardinalityVertexCoverSat::widenTotalizer(int node, int width)
+{
+    int target = std::min(width, tree[node].size);
+    if (static_cast<int>(tree[node].outputs.size()) >= target)
+    {
+        return;
+    }
+    int left = tree[node].left;
+    int right = tree[node].right;
+    widenTotalizer(left, target);
+    widenTotalizer(right, target);
+
+    // left count i plus right count j - i implies output j
+    for (int j = tree[node].outputs.size() + 1; j <= target; ++j)
+    {
+        Lit out = mkLit(solver.newVar());
+        tree[node].outputs.push_back(out);
+        for (int i = std::max(0, j - tree[right].size); i <= std::min(j, tree[left].size); ++i)
+        {
+            vec<Lit> clause;
+            if (i > 0)
+            {
+                clause.push(~tree[left].outputs[i - 1]);
+            }
+            if (j - i > 0)
+            {
+                clause.push(~tree[right].outputs[j - i - 1]);
+            }
+            clause.push(out);
+            solver.addClause(clause);
+        }
+    }
+}
+
+Lit CardinalityVertexCoverSat::atLeast(int j)
+{
+    if (encoding == ENCODING_TOTALIZER)
+    {
+        widenTotalizer(root, j);
+        return tree[root].outputs[j - 1];
+    }
+    widenCounter(j);
+    return counter[inputs.size() - 1][j - 1];
+}
+
+void CardinalityVertexCoverSat::setHint(const std::vector<int> &cover)
+{
+    VertexCoverSat::setHint(cover);
+    for (int vertex : cover)
+    {
+        if (vertexLit[vertex] != lit_Undef)
+        {
+            solver.prefer(var(vertexLit[vertex]), true);
+        }
+    }
+}
+
+bool CardinalityVertexCoverSat::solveForK(int k, std::vector<int> &cover)
+{
+    vec<Lit> assumptions;
+    if (k < static_cast<int>(inputs.size()))
+    {
+        assumptions.push(~atLeast(k + 1));
+    }
+
+    if (solve(solver, assumptions) != l_True)
+    {
+        return false;
+    }
+
+    cover.clear();
+    for (int i = 1; i <= v; ++i)
+    {
+        if (vertexLit[i] != lit_Undef && solver.modelValue(vertexLit[i]) == l_True)
+        {
+            cover.emplace_back(i);
+        }
+    }
+    return true;
+}
@@ -0,0 +1,166 @@
+#ifndef SAT_VC_H
+#define SAT_VC_H
+
+#include <vector>
+#include <utility>
+#include <functional>
+#include <pthread.h>
+#include "minisat/core/Solver.h"
+#include "minisat/core/SolverTypes.h"
+
+// Order in which cover sizes k are handed to the solver
+enum SatSearch
+{
+    SEARCH_LINEAR,
+    SEARCH_BINARY,
+    SEARCH_GALLOPING
+};
+
+// How "the cover has k vertices" is written as CNF
+enum SatEncoding
+{
+    ENCODING_POSITION,
+    ENCODING_SEQUENTIAL_COUNTER,
+    ENCODING_TOTALIZER
+};
+
+// MiniSat with a way to steer its first descent towards a known assignment
+class HintedSolver : public Minisat::Solver
+{
+public:
+    // Branch on v ahead of unhinted variables and try value first. Phase
+    // saving takes over once the solver has assigned v itself.
+    void prefer(Minisat::Var v, bool value);
+};
+
+// A CNF-SAT-VC reduction answering "is there a vertex cover of at most k vertices?"
+class VertexCoverSat
+{
+public:
+    VertexCoverSat();
+    virtual ~VertexCoverSat();
+
+    // Returns true and fills cover (ascending) when a cover of at most k vertices
+    // exists. The position encodings always return exactly k vertices. Also
+    // false once interrupted, so check interrupted() before reading it as UNSAT.
+    virtual bool solveForK(int k, std::vector<int> &cover) = 0;
+
+    // Safe from any thread: stops the solve in progress within one decision
+    // and makes every later solveForK() fail
+    void interrupt();
+    bool interrupted();
+
+    // A cover believed to be close to minimum, e.g. an approximation. Its
+    // vertices become the solver's initial phase and are branched on first;
+    // the position encodings put its i-th smallest vertex at position i.
+    virtual void setHint(const std::vector<int> &cover);
+
+protected:
+    // solveLimited() on solver, which interrupt() can reach while it runs
+    Minisat::lbool solve(Minisat::Solver &solver, const Minisat::vec<Minisat::Lit> &assumptions);
+
+    // Empty unless setHint() was called
+    std::vector<int> hint;
+
+private:
+    pthread_mutex_t mutex;
+    // Solver inside solve(), if any
+    Minisat::Solver *active;
+    bool stopped;
+};
+
+// Position encoding re-built from scratch in a fresh solver for every k.
+// With orderPositions the vertex at position j + 1 must have a larger index
+// than the one at position j, so each cover has one model instead of k!.
+class RebuildVertexCoverSat : public VertexCoverSat
+{
+public:
+    RebuildVertexCoverSat(int v, const std::vector<std::pair<int, int>> &pairVector, bool orderPositions);
+    bool solveForK(int k, std::vector<int> &cover) override;
+
+private:
+    int v;
+    const std::vector<std::pair<int, int>> &pairVector;
+    bool orderPositions;
+};
+
+// Position encoding that keeps a single MiniSat instance alive for every
+// cover size k. Positions are added lazily as k grows and are switched on/off
+// with assumption literals, so clauses learned for one k carry to the next.
+// orderPositions breaks the symmetry between positions as in the rebuild
+// engine; unused positions hold no vertex, so the ordering needs no guard.
+class IncrementalVertexCoverSat : public VertexCoverSat
+{
+public:
+    IncrementalVertexCoverSat(int v, const std::vector<std::pair<int, int>> &pairVector, bool orderPositions);
+    bool solveForK(int k, std::vector<int> &cover) override;
+
+private:
+    void addPosition();
+    void addEdgeClauses();
+
+    int v;
+    const std::vector<std::pair<int, int>> &pairVector;
+    bool orderPositions;
+    HintedSolver solver;
+    // literals_2d[i][j]: vertex i sits at position j (both 1-based, column 0 unused)
+    std::vector<std::vector<Minisat::Lit>> literals_2d;
+    // positionUsed[j]: position j holds a vertex; assumed true for j <= k, false otherwise
+    std::vector<Minisat::Lit> positionUsed;
+    // edge clauses are guarded so they can be retired when a new position is added
+    Minisat::Lit edgeGuard;
+    int edgePositions;
+};
+
+// One Boolean per vertex, one binary clause per edge and an at-most-k
+// constraint over the vertex literals, built as a sequential counter or a
+// totalizer. Counter outputs are only created up to k + 1 and widened when a
+// larger k is asked for, so the instance stays O(v * k) and fully incremental.
+class CardinalityVertexCoverSat : public VertexCoverSat
+{
+public:
+    CardinalityVertexCoverSat(int v, const std::vector<std::pair<int, int>> &pairVector, SatEncoding encoding);
+    bool solveForK(int k, std::vector<int> &cover) override;
+    void setHint(const std::vector<int> &cover) override;
+
+private:
+    struct TotalizerNode
+    {
+        int left;
+        int right;
+        int size;
+        // outputs[j - 1]: at least j of the leaves below this node are true
+        std::vector<Minisat::Lit> outputs;
+    };
+
+    Minisat::Lit atLeast(int j);
+    void widenCounter(int width);
+    int buildTotalizer(int begin, int end);
+    void widenTotalizer(int node, int width);
+
+    int v;
+    SatEncoding encoding;
+    HintedSolver solver;
+    // vertexLit[i]: vertex i is in the cover, lit_Undef for vertices without edges
+    std::vector<Minisat::Lit> vertexLit;
+    std::vector<Minisat::Lit> inputs;
+    // counter[i][j - 1]: at least j of inputs[0..i] are true
+    std::vector<std::vector<Minisat::Lit>> counter;
+    std::vector<TotalizerNode> tree;
+    int root;
+};
+
+// Searches the cover sizes k between lower and cover.size() for a minimum
+// vertex cover. On entry cover is a known cover (or empty) and lower a proven
+// lower bound; both are first tightened with the maximal-matching bounds
+// |M| <= OPT <= 2|M|. Every satisfiable k then shrinks cover and every
+// unsatisfiable k raises lower past it. Returns true with lower == |cover|
+// once cover is minimum. Returns false when deadlineReached() stops the
+// search or sat is interrupted, leaving the best cover found so far and
+// lower <= OPT <= |cover|.
+bool findMinimumCover(VertexCoverSat &sat, SatSearch search, int v,
+                      const std::vector<std::pair<int, int>> &pairVector,
+                      const std::function<bool()> &deadlineReached,
+                      std::vector<int> &cover, int &lower);
+
+#endif
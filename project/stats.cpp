@@ -0,0 +1,138 @@
+#include "stats.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace
+{
+const char *algorithmNames[STATS_ALGORITHMS] = {"CNF-SAT-VC", "APPROX-VC-1", "APPROX-VC-2"};
+
+// Nearest-rank percentile of sorted, non-empty samples
+double percentile(const std::vector<double> &sorted, double p)
+{
+    size_t rank = static_cast<size_t>(std::ceil(p / 100 * sorted.size()));
+    return sorted[std::max<size_t>(rank, 1) - 1];
+}
+
+void writeSummaryText(std::ostream &out, const char *metric, const Summary &summary)
+{
+    out << "    " << metric << ": n " << summary.count;
+    if (summary.count > 0)
+    {
+        out << " mean " << summary.mean << " stddev " << summary.stddev
+            << " min " << summary.min << " max " << summary.max
+            << " p50 " << summary.p50 << " p95 " << summary.p95 << " p99 " << summary.p99;
+    }
+    out << "\n";
+}
+
+void writeSummaryJson(std::ostream &out, const char *metric, const Summary &summary)
+{
+    out << "\"" << metric << "\": {\"count\": " << summary.count
+        << ", \"mean\": " << summary.mean << ", \"stddev\": " << summary.stddev
+        << ", \"min\": " << summary.min << ", \"max\": " << summary.max
+        << ", \"p50\": " << summary.p50 << ", \"p95\": " << summary.p95 << ", \"p99\": " << summary.p99 << "}";
+}
+}
+
+double calculateMean(const std::vector<double> &samples)
+{
+    double sum = std::accumulate(samples.begin(), samples.end(), 0.0);
+    return sum / samples.size();
+}
+
+double calculateStandardDeviation(const std::vector<double> &samples, double mean)
+{
+    double sum_sq_diff = 0.0;
+    for (double sample : samples)
+    {
+        sum_sq_diff += (sample - mean) * (sample - mean);
+    }
+    return std::sqrt(sum_sq_diff / samples.size());
+}
+
+Summary summarize(std::vector<double> samples)
+{
+    Summary summary = {samples.size(), 0, 0, 0, 0, 0, 0, 0};
+    if (samples.empty())
+    {
+        return summary;
+    }
+    std::sort(samples.begin(), samples.end());
+    summary.mean = calculateMean(samples);
+    summary.stddev = calculateStandardDeviation(samples, summary.mean);
+    summary.min = samples.front();
+    summary.max = samples.back();
+    summary.p50 = percentile(samples, 50);
+    summary.p95 = percentile(samples, 95);
+    summary.p99 = percentile(samples, 99);
+    return summary;
+}
+
+void RunStats::record(int vertices, StatsAlgorithm algorithm, bool timedOut, double ratio, double boundRatio,
+                      double cpuMicros, double wallMicros)
+{
+    std::vector<Samples> &group = groups[vertices];
+    group.resize(STATS_ALGORITHMS);
+    Samples &samples = group[algorithm];
+    ++samples.graphs;
+    samples.cpuMicros.push_back(cpuMicros);
+    samples.wallMicros.push_back(wallMicros);
+    if (timedOut)
+    {
+        ++samples.timeouts;
+        return;
+    }
+    if (ratio >= 0)
+    {
+        samples.ratio.push_back(ratio);
+    }
+    if (boundRatio >= 0)
+    {
+        samples.boundRatio.push_back(boundRatio);
+    }
+}
+
+void RunStats::writeText(std::ostream &out) const
+{
+    for (const auto &group : groups)
+    {
+        for (int algorithm = 0; algorithm < STATS_ALGORITHMS; ++algorithm)
+        {
+            const Samples &samples = group.second[algorithm];
+            out << "V " << group.first << " " << algorithmNames[algorithm] << ": graphs " << samples.graphs
+                << " timeouts " << samples.timeouts << "\n";
+            writeSummaryText(out, "ratio", summarize(samples.ratio));
+            writeSummaryText(out, "ratio_lb", summarize(samples.boundRatio));
+            writeSummaryText(out, "cpu_us", summarize(samples.cpuMicros));
+            writeSummaryText(out, "wall_us", summarize(samples.wallMicros));
+        }
+    }
+}
+
+void RunStats::writeJson(std::ostream &out) const
+{
+    out << "{\"groups\": [";
+    bool firstGroup = true;
+    for (const auto &group : groups)
+    {
+        out << (firstGroup ? "\n" : ",\n") << "  {\"vertices\": " << group.first << ", \"algorithms\": {";
+        firstGroup = false;
+        for (int algorithm = 0; algorithm < STATS_ALGORITHMS; ++algorithm)
+        {
+            const Samples &samples = group.second[algorithm];
+            out << (algorithm == 0 ? "\n" : ",\n") << "    \"" << algorithmNames[algorithm] << "\": {\"graphs\": " << samples.graphs
+                << ", \"timeouts\": " << samples.timeouts << ",\n      ";
+            writeSummaryJson(out, "ratio", summarize(samples.ratio));
+            out << ",\n      ";
+            writeSummaryJson(out, "ratio_lb", summarize(samples.boundRatio));
+            out << ",\n      ";
+            writeSummaryJson(out, "cpu_us", summarize(samples.cpuMicros));
+            out << ",\n      ";
+            writeSummaryJson(out, "wall_us", summarize(samples.wallMicros));
+            out << "}";
+        }
+        out << "}}";
+    }
+    out << "\n]}\n";
+}
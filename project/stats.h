@@ -0,0 +1,65 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include <map>
+#include <ostream>
+#include <vector>
+
+double calculateMean(const std::vector<double> &samples);
+double calculateStandardDeviation(const std::vector<double> &samples, double mean);
+
+// Distribution of one metric; everything but count is 0 when there are no samples
+struct Summary
+{
+    size_t count;
+    double mean;
+    double stddev;
+    double min;
+    double max;
+    double p50;
+    double p95;
+    double p99;
+};
+
+Summary summarize(std::vector<double> samples);
+
+enum StatsAlgorithm
+{
+    STATS_SAT,
+    STATS_APPROX_1,
+    STATS_APPROX_2,
+    STATS_ALGORITHMS
+};
+
+// Approximation ratios and run times of every algorithm over a whole run,
+// grouped by the vertex count of the input graph
+class RunStats
+{
+public:
+    // ratio is cover size over the optimum and boundRatio cover size over the
+    // best lower bound. Only called for runs that happened. Timed-out runs add
+    // no ratios but still add their times, so the time distributions include
+    // the runs that hit the deadline
+    void record(int vertices, StatsAlgorithm algorithm, bool timedOut, double ratio, double boundRatio,
+                double cpuMicros, double wallMicros);
+
+    void writeText(std::ostream &out) const;
+    void writeJson(std::ostream &out) const;
+
+private:
+    struct Samples
+    {
+        Samples() : graphs(0), timeouts(0) {}
+
+        size_t graphs;
+        size_t timeouts;
+        std::vector<double> ratio;
+        std::vector<double> boundRatio;
+        std::vector<double> cpuMicros;
+        std::vector<double> wallMicros;
+    };
+
+    std::map<int, std::vector<Samples>> groups;
+};
+
+#endif
@@ -0,0 +1,408 @@
+/**
+ * Unit tests for the project, using doctest. See documentation at
+ * https://github.com/onqtam/doctest/blob/master/doc/markdown/tutorial.md
+ */
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+#include "graph_parser.h"
+#include "kernel.h"
+#include "line_stream.h"
+
+typedef std::vector<std::pair<int, int>> EdgeList;
+
+namespace
+{
+
+bool isCover(const EdgeList &edges, const std::vector<int> &cover)
+{
+    for (const auto &edge : edges)
+    {
+        if (std::find(cover.begin(), cover.end(), edge.first) == cover.end() &&
+            std::find(cover.begin(), cover.end(), edge.second) == cover.end())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Tries every subset of 1..v, smallest first; only meant for tiny graphs
+std::vector<int> bruteForceCover(int v, const EdgeList &edges)
+{
+    std::vector<int> best;
+    for (int vertex = 1; vertex <= v; ++vertex)
+    {
+        best.push_back(vertex);
+    }
+    for (unsigned mask = 0; mask < (1u << v); ++mask)
+    {
+        std::vector<int> cover;
+        for (int vertex = 1; vertex <= v; ++vertex)
+        {
+            if (mask & (1u << (vertex - 1)))
+            {
+                cover.push_back(vertex);
+            }
+        }
+        if (cover.size() < best.size() && isCover(edges, cover))
+        {
+            best = cover;
+        }
+    }
+    return best;
+}
+
+// Checks the kernel against the original graph: every kernel edge is within
+// 1..k.v, the offset makes up the difference in OPT, and lifting a minimum
+// cover of the kernel gives a minimum cover of the original graph.
+void checkAgainstBruteForce(int v, const EdgeList &edges, const Kernel &k)
+{
+    for (const auto &edge : k.pairVector)
+    {
+        CHECK(edge.first >= 1);
+        CHECK(edge.first <= k.v);
+        CHECK(edge.second >= 1);
+        CHECK(edge.second <= k.v);
+    }
+
+    size_t opt = bruteForceCover(v, edges).size();
+    std::vector<int> kernelCover = bruteForceCover(k.v, k.pairVector);
+    CHECK(kernelCover.size() + k.coverOffset() == opt);
+
+    std::vector<int> lifted = k.lift(kernelCover);
+    CHECK(lifted.size() == opt);
+    CHECK(isCover(edges, lifted));
+    for (int vertex : lifted)
+    {
+        CHECK(vertex >= 1);
+        CHECK(vertex <= v);
+    }
+}
+
+std::vector<int> sorted(std::vector<int> cover)
+{
+    std::sort(cover.begin(), cover.end());
+    return cover;
+}
+
+EdgeList petersen(int first)
+{
+    EdgeList edges = {{0, 1}, {1, 2}, {2, 3}, {3, 4}, {4, 0}, {0, 5}, {1, 6}, {2, 7},
+                      {3, 8}, {4, 9}, {5, 7}, {7, 9}, {9, 6}, {6, 8}, {8, 5}};
+    for (auto &edge : edges)
+    {
+        edge.first += first;
+        edge.second += first;
+    }
+    return edges;
+}
+
+// Collects every edge handed to the sink as "a-b a-b ..." and rejects a
+// repeat in either direction, like the tools' own sinks
+struct EdgeRecorder
+{
+    std::string edges;
+    std::vector<std::pair<int, int>> seen;
+
+    bool add(int first, int second)
+    {
+        edges += (edges.empty() ? "" : " ") + std::to_string(first) + "-" + std::to_string(second);
+        std::pair<int, int> edge(std::min(first, second), std::max(first, second));
+        if (std::find(seen.begin(), seen.end(), edge) != seen.end())
+        {
+            return false;
+        }
+        seen.push_back(edge);
+        return true;
+    }
+};
+
+// Parses the E line through a pipe, so the scanner sees it in pieces of at
+// most bufferSize characters, the way the tools read stdin
+EdgeListResult parseThroughPipe(const std::string &text, bool strict, size_t bufferSize, EdgeReadState &state,
+                                std::string &edges)
+{
+    int fds[2];
+    REQUIRE(pipe(fds) == 0);
+    REQUIRE(write(fds[1], text.data(), text.size()) == static_cast<ssize_t>(text.size()));
+    close(fds[1]);
+
+    StreamLineReader reader(fds[0], bufferSize);
+    REQUIRE(reader.nextLine());
+    CommandScanner input(reader);
+    char command = '\0';
+    input.readChar(command);
+    CHECK(command == 'E');
+
+    EdgeRecorder recorder;
+    auto addEdge = [&](int first, int second) { return recorder.add(first, second); };
+    EdgeListResult result = parseEdgeList(input, 6, strict, addEdge, state);
+    close(fds[0]);
+    edges = recorder.edges;
+    return result;
+}
+
+struct ParseCase
+{
+    const char *line;
+    bool strict;
+    EdgeListError error;
+    int first;
+    int second;
+    bool closedEarly;
+    bool duplicate;
+    // Every edge handed to the sink, duplicates included
+    const char *edges;
+};
+
+// Expected results follow what the original std::istream readers did with
+// the same line, on a graph of 6 vertices
+const ParseCase parseCases[] = {
+    {"E {<1,2>,<2,3>}", true, EDGE_LIST_OK, 2, 3, false, false, "1-2 2-3"},
+    {"E  {  < 3 ,  4 >  }  ", true, EDGE_LIST_OK, 3, 4, false, false, "3-4"},
+    {"E {}", true, EDGE_LIST_OK, 0, 0, true, false, ""},
+    {"E { }", true, EDGE_LIST_OK, 0, 0, true, false, ""},
+    {"E", true, EDGE_LIST_BAD_OPEN, 0, 0, false, false, ""},
+    {"E   \t ", true, EDGE_LIST_BAD_OPEN, 0, 0, false, false, ""},
+    {"E <1,2>", true, EDGE_LIST_BAD_OPEN, 0, 0, false, false, ""},
+    {"E {", true, EDGE_BAD_OPEN, 0, 0, false, false, ""},
+    {"E {<", true, EDGE_BAD_FORMAT, 0, 0, false, false, ""},
+    {"E {<+,2>}", true, EDGE_BAD_FORMAT, 0, 0, false, false, ""},
+    {"E {<1,2", true, EDGE_BAD_FORMAT, 0, 0, false, false, ""},
+    {"E {<1,99999999999>}", true, EDGE_BAD_FORMAT, 0, 0, false, false, ""},
+    {"E {<+1,-2>}", true, EDGE_OUT_OF_RANGE, 1, -2, false, false, ""},
+    {"E {<1,1>}", true, EDGE_OUT_OF_RANGE, 1, 1, false, false, ""},
+    {"E {<1,7>}", true, EDGE_OUT_OF_RANGE, 1, 7, false, false, ""},
+    {"E {<1,2>,<2,1>}", true, EDGE_DUPLICATE, 2, 1, false, false, "1-2 2-1"},
+    // The failed reads after the ',' keep the previous edge's values
+    {"E {<1,2>,", true, EDGE_DUPLICATE, 1, 2, false, false, "1-2 1-2"},
+    {"E {<1,2>;<2,3>}", true, EDGE_BAD_SEPARATOR, 1, 2, false, false, "1-2"},
+    {"E {<1,2>", true, EDGE_BAD_SEPARATOR, 1, 2, false, false, "1-2"},
+    {"E {<1,2>,<2,3>", true, EDGE_LIST_BAD_CLOSE, 2, 3, false, false, "1-2 2-3"},
+
+    {"E {<1,2>,<2,3>}", false, EDGE_LIST_OK, 2, 3, false, false, "1-2 2-3"},
+    {"E {<1,2>}}", false, EDGE_LIST_OK, 1, 2, false, false, "1-2"},
+    // Nothing ends the list, so the loop goes round once more on stale values
+    {"E [(1;2)]", false, EDGE_LIST_OK, 1, 2, false, true, "1-2 1-2"},
+    {"E {}", false, EDGE_LIST_OK, 0, 0, true, false, ""},
+    {"E", false, EDGE_LIST_OK, 0, 0, false, false, ""},
+    {"E   \t ", false, EDGE_LIST_OK, 0, 0, false, false, ""},
+    {"E {", false, EDGE_OUT_OF_RANGE, 0, 0, false, false, ""},
+    {"E {<", false, EDGE_OUT_OF_RANGE, 0, 0, false, false, ""},
+    {"E+2", false, EDGE_OUT_OF_RANGE, 0, 0, false, false, ""},
+    {"E {<+,2>}", false, EDGE_OUT_OF_RANGE, 0, 0, false, false, ""},
+    {"E {<-1,2>}", false, EDGE_OUT_OF_RANGE, -1, 2, false, false, ""},
+    {"E {<1,2>,<2,1>}", false, EDGE_LIST_OK, 2, 1, false, true, "1-2 2-1"},
+    {"E {<1,2>,<", false, EDGE_LIST_OK, 1, 2, false, true, "1-2 1-2"},
+};
+
+} // namespace
+
+TEST_CASE("Edge list parser matches the istream readers")
+{
+    for (const ParseCase &c : parseCases)
+    {
+        for (size_t bufferSize : {1, 2, 3, 64})
+        {
+            // The last line of the input may have no '\n' at all
+            for (const char *ending : {"", "\n", "\nV 3\n"})
+            {
+                INFO("line: \"" << std::string(c.line) << "\" strict: " << c.strict << " buffer: " << bufferSize
+                                 << " followed by: \"" << std::string(ending) << "\"");
+                EdgeReadState state = {'\0', 0, '\0', 0, '\0'};
+                std::string edges;
+                EdgeListResult result =
+                    parseThroughPipe(std::string(c.line) + ending, c.strict, bufferSize, state, edges);
+                CHECK(result.error == c.error);
+                CHECK(result.first == c.first);
+                CHECK(result.second == c.second);
+                CHECK(result.closedEarly == c.closedEarly);
+                CHECK(result.duplicate == c.duplicate);
+                CHECK(edges == std::string(c.edges));
+            }
+        }
+    }
+}
+
+TEST_CASE("Edge list parser works on a character range")
+{
+    for (const ParseCase &c : parseCases)
+    {
+        INFO("line: \"" << std::string(c.line) << "\" strict: " << c.strict);
+        std::string line(c.line);
+        CommandScanner input(line.data(), line.data() + line.size());
+        char command = '\0';
+        input.readChar(command);
+        EdgeRecorder recorder;
+        auto addEdge = [&](int first, int second) { return recorder.add(first, second); };
+        EdgeListResult result = parseEdgeList(input, 6, c.strict, addEdge);
+        CHECK(result.error == c.error);
+        CHECK(result.first == c.first);
+        CHECK(result.second == c.second);
+        CHECK(result.closedEarly == c.closedEarly);
+        CHECK(result.duplicate == c.duplicate);
+        CHECK(recorder.edges == std::string(c.edges));
+    }
+}
+
+TEST_CASE("Lenient edge list parser carries failed reads over from the previous line")
+{
+    // a3 kept its edge variables in the main loop, so `E+2` after a list
+    // ending in <1,2> reads that edge again instead of failing
+    EdgeReadState state = {'\0', 0, '\0', 0, '\0'};
+    std::string edges;
+    EdgeListResult result = parseThroughPipe("E {<1,2>}\n", false, 64, state, edges);
+    CHECK(result.error == EDGE_LIST_OK);
+    result = parseThroughPipe("E+2", false, 64, state, edges);
+    CHECK(result.error == EDGE_LIST_OK);
+    CHECK(edges == "1-2");
+
+    // A list closed early leaves '}' behind, so the next unterminated list
+    // counts as closed early too
+    parseThroughPipe("E {}\n", false, 64, state, edges);
+    result = parseThroughPipe("E {", false, 64, state, edges);
+    CHECK(result.error == EDGE_LIST_OK);
+    CHECK(result.closedEarly);
+    CHECK(edges.empty());
+
+    // A fresh state fails the same line
+    EdgeReadState fresh = {'\0', 0, '\0', 0, '\0'};
+    result = parseThroughPipe("E+2", false, 64, fresh, edges);
+    CHECK(result.error == EDGE_OUT_OF_RANGE);
+}
+
+TEST_CASE("Kernel pendant rule takes the neighbour of a degree-1 vertex")
+{
+    EdgeList path = {{1, 2}, {2, 3}};
+    Kernel k(3, path);
+    CHECK(k.v == 0);
+    CHECK(k.pairVector.empty());
+    CHECK(k.coverOffset() == 1);
+    CHECK(sorted(k.lift({})) == std::vector<int>{2});
+    checkAgainstBruteForce(3, path, k);
+
+    EdgeList star = {{1, 2}, {1, 3}, {1, 4}, {1, 5}};
+    Kernel s(5, star);
+    CHECK(s.v == 0);
+    CHECK(s.coverOffset() == 1);
+    CHECK(sorted(s.lift({})) == std::vector<int>{1});
+    checkAgainstBruteForce(5, star, s);
+}
+
+TEST_CASE("Kernel pendant rule relabels what is left")
+{
+    // A path on 1..3 next to a Petersen graph on 4..13, which no rule reduces
+    EdgeList edges = {{1, 2}, {2, 3}};
+    EdgeList rest = petersen(4);
+    edges.insert(edges.end(), rest.begin(), rest.end());
+    Kernel k(13, edges);
+    CHECK(k.v == 10);
+    CHECK(k.pairVector.size() == 15);
+    CHECK(k.coverOffset() == 1);
+    checkAgainstBruteForce(13, edges, k);
+}
+
+TEST_CASE("Kernel degree-2 rule takes both neighbours of a triangle")
+{
+    EdgeList triangle = {{1, 2}, {2, 3}, {1, 3}};
+    Kernel k(3, triangle);
+    CHECK(k.v == 0);
+    CHECK(k.coverOffset() == 2);
+    CHECK(sorted(k.lift({})) == (std::vector<int>{2, 3}));
+    checkAgainstBruteForce(3, triangle, k);
+}
+
+TEST_CASE("Kernel degree-2 rule folds non-adjacent neighbours")
+{
+    // 1 folds with 2 and 4 into a vertex whose only neighbour is 3; the
+    // pendant rule then takes the fold vertex, which lifts back to 2 and 4
+    EdgeList square = {{1, 2}, {2, 3}, {3, 4}, {4, 1}};
+    Kernel k(4, square);
+    CHECK(k.v == 0);
+    CHECK(k.coverOffset() == 2);
+    CHECK(sorted(k.lift({})) == (std::vector<int>{2, 4}));
+    checkAgainstBruteForce(4, square, k);
+
+    EdgeList pentagon = {{1, 2}, {2, 3}, {3, 4}, {4, 5}, {5, 1}};
+    Kernel p(5, pentagon);
+    CHECK(p.v == 0);
+    CHECK(p.coverOffset() == 3);
+    checkAgainstBruteForce(5, pentagon, p);
+
+    // A degree-2 vertex hung off a Petersen graph; the fold leaves a kernel
+    EdgeList edges = petersen(1);
+    edges.emplace_back(11, 1);
+    edges.emplace_back(11, 3);
+    Kernel g(11, edges);
+    checkAgainstBruteForce(11, edges, g);
+}
+
+TEST_CASE("Kernel dominance rule takes a vertex whose closed neighbourhood covers a neighbour's")
+{
+    EdgeList clique = {{1, 2}, {1, 3}, {1, 4}, {2, 3}, {2, 4}, {3, 4}};
+    Kernel k(4, clique);
+    CHECK(k.v == 0);
+    CHECK(k.coverOffset() == 3);
+    checkAgainstBruteForce(4, clique, k);
+}
+
+TEST_CASE("Kernel Buss rule takes a vertex of degree above the matching bound")
+{
+    // K(3,7): every degree is at least 3 and no neighbourhood dominates
+    // another, but 1, 2 and 3 each have more neighbours than the 6 endpoints
+    // of a maximal matching
+    EdgeList edges;
+    for (int a = 1; a <= 3; ++a)
+    {
+        for (int b = 4; b <= 10; ++b)
+        {
+            edges.emplace_back(a, b);
+        }
+    }
+    Kernel k(10, edges);
+    CHECK(k.v == 0);
+    CHECK(k.coverOffset() == 3);
+    CHECK(sorted(k.lift({})) == (std::vector<int>{1, 2, 3}));
+    checkAgainstBruteForce(10, edges, k);
+}
+
+TEST_CASE("Kernel leaves an irreducible graph alone")
+{
+    EdgeList edges = petersen(1);
+    Kernel k(10, edges);
+    CHECK(k.v == 10);
+    CHECK(k.pairVector.size() == 15);
+    CHECK(k.coverOffset() == 0);
+    checkAgainstBruteForce(10, edges, k);
+}
+
+TEST_CASE("Kernel matches brute force on small random graphs")
+{
+    std::mt19937 random(650);
+    for (int round = 0; round < 300; ++round)
+    {
+        int v = 2 + static_cast<int>(random() % 11);
+        int percent = 15 + static_cast<int>(random() % 60);
+        EdgeList edges;
+        for (int a = 1; a <= v; ++a)
+        {
+            for (int b = a + 1; b <= v; ++b)
+            {
+                if (static_cast<int>(random() % 100) < percent)
+                {
+                    edges.emplace_back(a, b);
+                }
+            }
+        }
+        Kernel k(v, edges);
+        checkAgainstBruteForce(v, edges, k);
+    }
+}
@@ -0,0 +1,55 @@
+#include "thread_pool.h"
+
+ThreadPool::ThreadPool(int threads) : workers(threads), stopping(false)
+{
+    pthread_mutex_init(&mutex, nullptr);
+    pthread_cond_init(&available, nullptr);
+    for (pthread_t &worker : workers)
+    {
+        pthread_create(&worker, nullptr, workerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    pthread_mutex_lock(&mutex);
+    stopping = true;
+    pthread_cond_broadcast(&available);
+    pthread_mutex_unlock(&mutex);
+    for (pthread_t &worker : workers)
+    {
+        pthread_join(worker, nullptr);
+    }
+    pthread_cond_destroy(&available);
+    pthread_mutex_destroy(&mutex);
+}
+
+void ThreadPool::submit(std::function<void()> task)
+{
+    pthread_mutex_lock(&mutex);
+    tasks.push_back(std::move(task));
+    pthread_cond_signal(&available);
+    pthread_mutex_unlock(&mutex);
+}
+
+void *ThreadPool::workerLoop(void *arg)
+{
+    ThreadPool *pool = reinterpret_cast<ThreadPool *>(arg);
+    while (true)
+    {
+        pthread_mutex_lock(&pool->mutex);
+        while (pool->tasks.empty() && !pool->stopping)
+        {
+            pthread_cond_wait(&pool->available, &pool->mutex);
+        }
+        if (pool->tasks.empty())
+        {
+            pthread_mutex_unlock(&pool->mutex);
+            return nullptr;
+        }
+        std::function<void()> task = std::move(pool->tasks.front());
+        pool->tasks.pop_front();
+        pthread_mutex_unlock(&pool->mutex);
+        task();
+    }
+}
@@ -0,0 +1,29 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <pthread.h>
+#include <deque>
+#include <vector>
+#include <functional>
+
+// Fixed set of long-lived worker threads fed from a FIFO task queue
+class ThreadPool
+{
+public:
+    explicit ThreadPool(int threads);
+    // Runs the tasks still queued, then joins the workers
+    ~ThreadPool();
+
+    void submit(std::function<void()> task);
+
+private:
+    static void *workerLoop(void *arg);
+
+    pthread_mutex_t mutex;
+    pthread_cond_t available;
+    std::deque<std::function<void()>> tasks;
+    std::vector<pthread_t> workers;
+    bool stopping;
+};
+
+#endif
@@ -0,0 +1,29 @@
+#include "timing.h"
+#include <time.h>
+
+double threadCpuMicros()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+    return (now.tv_sec * 1e6) + (now.tv_nsec / 1e3);
+}
+
+double wallMicrosSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+Stopwatch::Stopwatch()
+    : cpuStart(threadCpuMicros()), wallStart(std::chrono::steady_clock::now())
+{
+}
+
+double Stopwatch::cpuMicros() const
+{
+    return threadCpuMicros() - cpuStart;
+}
+
+double Stopwatch::wallMicros() const
+{
+    return wallMicrosSince(wallStart);
+}
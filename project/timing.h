@@ -0,0 +1,28 @@
+#ifndef TIMING_H
+#define TIMING_H
+
+#include <chrono>
+
+// CPU time consumed so far by the calling thread, in microseconds
+double threadCpuMicros();
+
+// Microseconds elapsed on the monotonic clock since start
+double wallMicrosSince(std::chrono::steady_clock::time_point start);
+
+// Times one piece of work on the calling thread from construction on: CPU
+// time from the thread CPU clock, which leaves out time spent waiting or
+// preempted, and elapsed wall-clock time
+class Stopwatch
+{
+public:
+    Stopwatch();
+
+    double cpuMicros() const;
+    double wallMicros() const;
+
+private:
+    double cpuStart;
+    std::chrono::steady_clock::time_point wallStart;
+};
+
+#endif
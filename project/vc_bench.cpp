@@ -0,0 +1,379 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <functional>
+#include <algorithm>
+#include <random>
+#include <atomic>
+#include <cstdlib>
+#include "graph.h"
+#include "timing.h"
+#include "vertex_cover.h"
+
+// Benchmarks the vertex cover engines over generated graph families and
+// prints one CSV row or JSON object per timed run
+
+// One engine under test: fills cover, false if it gave up (CNF-SAT-VC timeout,
+// which still leaves the best cover it found)
+struct Engine
+{
+    const char *name;
+    std::function<bool(const CsrGraph &, std::vector<int> &, double &)> run;
+};
+
+// New engines only need a row here
+std::vector<Engine> makeEngines()
+{
+    std::vector<Engine> engines;
+    engines.push_back({"CNF-SAT-VC", [](const CsrGraph &graph, std::vector<int> &cover, double &helperCpuMicros)
+                       {
+                           std::atomic<bool> timedOut(false);
+                           int lower = 0;
+                           // The starting cover is part of what CNF-SAT-VC costs
+                           findVectorCover_1(graph, cover);
+                           return findVectorCover(graph, cover, lower, timedOut, helperCpuMicros);
+                       }});
+    engines.push_back({"APPROX-VC-1", [](const CsrGraph &graph, std::vector<int> &cover, double &)
+                       {
+                           findVectorCover_1(graph, cover);
+                           return true;
+                       }});
+    engines.push_back({"APPROX-VC-2", [](const CsrGraph &graph, std::vector<int> &cover, double &)
+                       {
+                           findVectorCover_2(graph, cover);
+                           return true;
+                       }});
+    return engines;
+}
+
+const std::vector<std::string> graphFamilies = {"random", "cycle", "grid", "star", "complete"};
+
+// Edges of one member of a family on n vertices, numbered 1..n
+bool generateEdges(const std::string &family, int n, double density, std::mt19937 &random, std::vector<std::pair<int, int>> &edges)
+{
+    if (family == "random")
+    {
+        // G(n, p): every pair independently with probability density
+        std::bernoulli_distribution keep(density);
+        for (int a = 1; a <= n; ++a)
+        {
+            for (int b = a + 1; b <= n; ++b)
+            {
+                if (keep(random))
+                {
+                    edges.emplace_back(a, b);
+                }
+            }
+        }
+    }
+    else if (family == "cycle")
+    {
+        for (int a = 1; a < n; ++a)
+        {
+            edges.emplace_back(a, a + 1);
+        }
+        // On two vertices the closing edge would repeat <1,2>
+        if (n > 2)
+        {
+            edges.emplace_back(n, 1);
+        }
+    }
+    else if (family == "grid")
+    {
+        // Rows of width ceil(sqrt(n)), the last one possibly short
+        int width = 1;
+        while (width * width < n)
+        {
+            ++width;
+        }
+        for (int a = 1; a <= n; ++a)
+        {
+            if (a % width != 0 && a < n)
+            {
+                edges.emplace_back(a, a + 1);
+            }
+            if (a + width <= n)
+            {
+                edges.emplace_back(a, a + width);
+            }
+        }
+    }
+    else if (family == "star")
+    {
+        for (int a = 2; a <= n; ++a)
+        {
+            edges.emplace_back(1, a);
+        }
+    }
+    else if (family == "complete")
+    {
+        for (int a = 1; a <= n; ++a)
+        {
+            for (int b = a + 1; b <= n; ++b)
+            {
+                edges.emplace_back(a, b);
+            }
+        }
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+bool isCover(const CsrGraph &graph, const std::vector<int> &cover)
+{
+    std::vector<bool> inCover(graph.v + 1, false);
+    for (int vertex : cover)
+    {
+        if (vertex < 1 || vertex > graph.v)
+        {
+            return false;
+        }
+        inCover[vertex] = true;
+    }
+    for (const auto &pair : graph.pairVector)
+    {
+        if (!inCover[pair.first] && !inCover[pair.second])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Lowers the kernel's peak resident set size mark to the current size, so
+// the next peakRssKb() covers only what ran in between (Linux 4.0 and later)
+bool resetPeakRss()
+{
+    std::ofstream clear("/proc/self/clear_refs");
+    clear << "5";
+    clear.flush();
+    return static_cast<bool>(clear);
+}
+
+// Peak resident set size since the last resetPeakRss(), in KiB, or -1
+long peakRssKb()
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+    {
+        if (line.compare(0, 6, "VmHWM:") == 0)
+        {
+            return std::atol(line.c_str() + 6);
+        }
+    }
+    return -1;
+}
+
+std::vector<std::string> splitList(const std::string &list)
+{
+    std::vector<std::string> items;
+    std::istringstream input(list);
+    std::string item;
+    while (std::getline(input, item, ','))
+    {
+        if (!item.empty())
+        {
+            items.push_back(item);
+        }
+    }
+    return items;
+}
+
+int main(int argc, char **argv)
+{
+    std::vector<std::string> families = {"random"};
+    std::vector<int> sizes = {5, 10, 15};
+    std::vector<std::string> engineNames;
+    double density = 0.3;
+    int graphs = 5;
+    int reps = 3;
+    int warmup = 1;
+    unsigned seed = 1;
+    bool json = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--families" && i + 1 < argc)
+        {
+            families = splitList(argv[++i]);
+            for (const std::string &family : families)
+            {
+                if (std::find(graphFamilies.begin(), graphFamilies.end(), family) == graphFamilies.end())
+                {
+                    std::cerr << "Error: Unknown graph family " << family << "\n";
+                    return 1;
+                }
+            }
+        }
+        else if (arg == "--sizes" && i + 1 < argc)
+        {
+            sizes.clear();
+            for (const std::string &size : splitList(argv[++i]))
+            {
+                sizes.push_back(std::atoi(size.c_str()));
+                if (sizes.back() < 2)
+                {
+                    std::cerr << "Error: Graph sizes must be at least 2\n";
+                    return 1;
+                }
+            }
+        }
+        else if (arg == "--engines" && i + 1 < argc)
+        {
+            engineNames = splitList(argv[++i]);
+            std::vector<Engine> known = makeEngines();
+            for (const std::string &name : engineNames)
+            {
+                if (std::find_if(known.begin(), known.end(), [&](const Engine &engine)
+                                 { return name == engine.name; }) == known.end())
+                {
+                    std::cerr << "Error: Unknown engine " << name << "\n";
+                    return 1;
+                }
+            }
+        }
+        else if (arg == "--density" && i + 1 < argc)
+        {
+            density = std::atof(argv[++i]);
+        }
+        else if (arg == "--graphs" && i + 1 < argc)
+        {
+            graphs = std::atoi(argv[++i]);
+        }
+        else if (arg == "--reps" && i + 1 < argc)
+        {
+            reps = std::atoi(argv[++i]);
+        }
+        else if (arg == "--warmup" && i + 1 < argc)
+        {
+            warmup = std::atoi(argv[++i]);
+        }
+        else if (arg == "--seed" && i + 1 < argc)
+        {
+            seed = std::strtoul(argv[++i], nullptr, 10);
+        }
+        else if (arg == "--format" && i + 1 < argc)
+        {
+            std::string format = argv[++i];
+            if (format != "csv" && format != "json")
+            {
+                std::cerr << "Error: Unknown format " << format << "\n";
+                return 1;
+            }
+            json = format == "json";
+        }
+        else if ((arg == "--sat-mode" || arg == "--search" || arg == "--encoding") && i + 1 < argc)
+        {
+            if (!parseSatOption(argv[i], argv[i + 1]))
+            {
+                return 1;
+            }
+            ++i;
+        }
+        else if (arg == "--components")
+        {
+            splitIntoComponents = true;
+        }
+        else if (arg == "--phase-hints")
+        {
+            satPhaseHints = true;
+        }
+        else if (arg == "--symmetry-breaking")
+        {
+            satSymmetryBreaking = true;
+        }
+        else
+        {
+            std::cerr << "Error: Unknown option " << arg << "\n";
+            return 1;
+        }
+    }
+
+    std::vector<Engine> engines;
+    for (const Engine &engine : makeEngines())
+    {
+        bool wanted = engineNames.empty();
+        for (const std::string &name : engineNames)
+        {
+            wanted = wanted || name == engine.name;
+        }
+        if (wanted)
+        {
+            engines.push_back(engine);
+        }
+    }
+
+    std::mt19937 random(seed);
+    bool firstRow = true;
+    if (json)
+    {
+        std::cout << "[";
+    }
+    else
+    {
+        std::cout << "family,vertices,edges,graph,engine,rep,wall_us,cpu_us,cover_size,valid,timeout,peak_rss_kb\n";
+    }
+    for (const std::string &family : families)
+    {
+        for (int n : sizes)
+        {
+            for (int g = 0; g < graphs; ++g)
+            {
+                std::vector<std::pair<int, int>> edges;
+                generateEdges(family, n, density, random, edges);
+                CsrGraph graph(n, edges);
+
+                for (const Engine &engine : engines)
+                {
+                    for (int rep = -warmup; rep < reps; ++rep)
+                    {
+                        std::vector<int> cover;
+                        double helperCpuMicros = 0;
+                        bool measured = resetPeakRss();
+                        Stopwatch watch;
+                        bool finished = engine.run(graph, cover, helperCpuMicros);
+                        double cpuMicros = watch.cpuMicros() + helperCpuMicros;
+                        double wallMicros = watch.wallMicros();
+                        if (rep < 0)
+                        {
+                            continue;
+                        }
+                        long peakRss = measured ? peakRssKb() : -1;
+
+                        bool valid = isCover(graph, cover);
+                        size_t coverSize = cover.size();
+                        if (json)
+                        {
+                            std::cout << (firstRow ? "\n" : ",\n")
+                                      << "  {\"family\": \"" << family << "\", \"vertices\": " << n
+                                      << ", \"edges\": " << edges.size() << ", \"graph\": " << g
+                                      << ", \"engine\": \"" << engine.name << "\", \"rep\": " << rep
+                                      << ", \"wall_us\": " << wallMicros << ", \"cpu_us\": " << cpuMicros
+                                      << ", \"cover_size\": " << coverSize << ", \"valid\": " << (valid ? "true" : "false")
+                                      << ", \"timeout\": " << (finished ? "false" : "true")
+                                      << ", \"peak_rss_kb\": " << peakRss << "}";
+                        }
+                        else
+                        {
+                            std::cout << family << "," << n << "," << edges.size() << "," << g << ","
+                                      << engine.name << "," << rep << "," << wallMicros << "," << cpuMicros << ","
+                                      << coverSize << "," << valid << "," << !finished << "," << peakRss << "\n";
+                        }
+                        firstRow = false;
+                    }
+                }
+            }
+        }
+    }
+    if (json)
+    {
+        std::cout << "\n]\n";
+    }
+    return 0;
+}
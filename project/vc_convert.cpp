@@ -0,0 +1,128 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <unordered_set>
+#include <cstdint>
+#include <cstdio>
+#include <algorithm>
+#include "graph.h"
+#include "graph_file.h"
+#include "graph_parser.h"
+#include "line_reader.h"
+
+// Converts V/E text input into the binary graph file format read by
+// ece650-prj --graph-file. Graphs the text reader would reject are skipped
+// with the same error messages; s and other commands are ignored.
+int main(int argc, char **argv)
+{
+    LineReader reader;
+    std::FILE *out = stdout;
+    bool checksum = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--input" && i + 1 < argc)
+        {
+            std::string path = argv[++i];
+            if (!reader.open(path))
+            {
+                std::cerr << "Error: Cannot open input file " << path << "\n";
+                return 1;
+            }
+        }
+        else if (arg == "--output" && i + 1 < argc)
+        {
+            std::string path = argv[++i];
+            out = std::fopen(path.c_str(), "wb");
+            if (out == nullptr)
+            {
+                std::cerr << "Error: Cannot open output file " << path << "\n";
+                return 1;
+            }
+        }
+        else if (arg == "--checksum")
+        {
+            checksum = true;
+        }
+        else
+        {
+            std::cerr << "Error: Unknown option " << arg << "\n";
+            return 1;
+        }
+    }
+
+    std::vector<std::pair<int, int>> pairVector;
+    int vertices = 0;
+    int written = 0;
+    // The edge reader's variables keep their values from one line to the next
+    EdgeReadState edgeState = {'\0', 0, '\0', 0, '\0'};
+    while (reader.nextLine())
+    {
+        CommandScanner input(reader);
+        char first = '\0';
+        if (!input.peekRawChar(first) || first == ' ')
+        {
+            continue;
+        }
+        char command = '\0';
+        input.readChar(command);
+
+        if (command == 'V')
+        {
+            // Same as ece650-prj: the last number on the line wins
+            int count = 0;
+            bool valid = true;
+            while (valid && !input.eof())
+            {
+                valid = input.readInt(count);
+            }
+            if (!valid)
+            {
+                std::cerr << "Error: Invalid input for vertices \n";
+                continue;
+            }
+            vertices = count > 1 ? count : 0;
+        }
+        else if (command == 'E')
+        {
+            if (vertices == 0)
+            {
+                std::cerr << "Error: Missing vertices Input \n";
+                continue;
+            }
+
+            pairVector.clear();
+            std::unordered_set<uint64_t> seenEdges;
+            auto addEdge = [&](int first, int second)
+            {
+                uint64_t edgeKey = (static_cast<uint64_t>(std::min(first, second)) << 32) | std::max(first, second);
+                pairVector.emplace_back(first, second);
+                return seenEdges.insert(edgeKey).second;
+            };
+            EdgeListResult edges = parseEdgeList(input, vertices, false, addEdge, edgeState);
+            // Like ece650-prj, every graph needs its own V line
+            int v = vertices;
+            vertices = 0;
+            if (edges.error != EDGE_LIST_OK || edges.duplicate)
+            {
+                std::cerr << "Error: Invalid Edges \n";
+                continue;
+            }
+
+            if (!writeGraph(out, CsrGraph(v, pairVector), checksum))
+            {
+                std::cerr << "Error: Cannot write graph file\n";
+                return 1;
+            }
+            ++written;
+        }
+    }
+
+    if (std::fflush(out) != 0 || (out != stdout && std::fclose(out) != 0))
+    {
+        std::cerr << "Error: Cannot write graph file\n";
+        return 1;
+    }
+    std::cerr << written << " graphs written\n";
+    return 0;
+}
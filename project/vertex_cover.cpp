@@ -0,0 +1,352 @@
+#include "vertex_cover.h"
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <pthread.h>
+#include "components.h"
+#include "lower_bound.h"
+#include "timing.h"
+#include "watchdog.h"
+
+SatMode satMode = SAT_INCREMENTAL;
+SatSearch satSearch = SEARCH_LINEAR;
+SatEncoding satEncoding = ENCODING_POSITION;
+bool splitIntoComponents = false;
+bool satPhaseHints = false;
+bool satSymmetryBreaking = false;
+const std::chrono::seconds satTimeLimit(15);
+// Component helper threads still allowed across all graphs being solved, so
+// that --components with --batch N does not start N helpers per core
+std::atomic<int> spareComponentThreads(std::max(1u, std::thread::hardware_concurrency()) - 1);
+
+bool parseSatOption(const char *option, const char *value)
+{
+    std::string name = option;
+    std::string setting = value;
+    if (name == "--sat-mode")
+    {
+        if (setting == "incremental")
+        {
+            satMode = SAT_INCREMENTAL;
+        }
+        else if (setting == "rebuild")
+        {
+            satMode = SAT_REBUILD;
+        }
+        else
+        {
+            std::cerr << "Error: Unknown SAT mode " << setting << "\n";
+            return false;
+        }
+    }
+    else if (name == "--search")
+    {
+        if (setting == "linear")
+        {
+            satSearch = SEARCH_LINEAR;
+        }
+        else if (setting == "binary")
+        {
+            satSearch = SEARCH_BINARY;
+        }
+        else if (setting == "galloping")
+        {
+            satSearch = SEARCH_GALLOPING;
+        }
+        else
+        {
+            std::cerr << "Error: Unknown search strategy " << setting << "\n";
+            return false;
+        }
+    }
+    else if (name == "--encoding")
+    {
+        if (setting == "position")
+        {
+            satEncoding = ENCODING_POSITION;
+        }
+        else if (setting == "seqcounter")
+        {
+            satEncoding = ENCODING_SEQUENTIAL_COUNTER;
+        }
+        else if (setting == "totalizer")
+        {
+            satEncoding = ENCODING_TOTALIZER;
+        }
+        else
+        {
+            std::cerr << "Error: Unknown encoding " << setting << "\n";
+            return false;
+        }
+    }
+    else
+    {
+        std::cerr << "Error: Unknown option " << name << "\n";
+        return false;
+    }
+    return true;
+}
+
+// Connected components of one graph shared by the CNF-SAT-VC workers
+struct ComponentJob
+{
+    const std::vector<Component> &components;
+    std::vector<std::vector<int>> covers;
+    // Proven lower bound on the minimum cover of each component
+    std::vector<int> lowers;
+    std::atomic<size_t> next;
+    std::chrono::steady_clock::time_point start_time;
+    std::atomic<bool> &timedOut;
+    std::atomic<bool> failed;
+    // CPU time of the extra worker threads, which the caller's clock misses
+    std::atomic<long long> helperCpuMicros;
+};
+
+void *componentWorker(void *args);
+void *componentHelper(void *args);
+int claimComponentThreads(int wanted);
+
+bool satDeadlineReached(std::chrono::steady_clock::time_point start_time, std::atomic<bool> &timedOut)
+{
+    auto current_time = std::chrono::steady_clock::now();
+    if (timedOut.load())
+    {
+        return true;
+    }
+
+    if (current_time - start_time >= satTimeLimit)
+    {
+        timedOut.store(true);
+        return true;
+    }
+    return false;
+}
+
+std::unique_ptr<VertexCoverSat> makeVertexCoverSat(int v, const std::vector<std::pair<int, int>> &pairVector)
+{
+    std::unique_ptr<VertexCoverSat> sat;
+    if (satEncoding != ENCODING_POSITION)
+    {
+        sat.reset(new CardinalityVertexCoverSat(v, pairVector, satEncoding));
+    }
+    else if (satMode == SAT_REBUILD)
+    {
+        sat.reset(new RebuildVertexCoverSat(v, pairVector, satSymmetryBreaking));
+    }
+    else
+    {
+        sat.reset(new IncrementalVertexCoverSat(v, pairVector, satSymmetryBreaking));
+    }
+    return sat;
+}
+
+void *componentWorker(void *args)
+{
+    ComponentJob *job = reinterpret_cast<ComponentJob *>(args);
+    for (size_t i = job->next++; i < job->components.size(); i = job->next++)
+    {
+        const Component &component = job->components[i];
+        CsrGraph graph(component.v, component.pairVector);
+        job->lowers[i] = computeLowerBounds(graph).best();
+        std::unique_ptr<VertexCoverSat> sat = makeVertexCoverSat(component.v, component.pairVector);
+        if (satPhaseHints)
+        {
+            sat->setHint(job->covers[i]);
+        }
+        WatchedSat watched(*sat, job->start_time + satTimeLimit, job->timedOut);
+        if (!findMinimumCover(*sat, satSearch, component.v, component.pairVector, [&]()
+                              { return satDeadlineReached(job->start_time, job->timedOut); },
+                              job->covers[i], job->lowers[i]))
+        {
+            job->failed = true;
+        }
+    }
+    return nullptr;
+}
+
+// componentWorker on a thread of its own, which adds its CPU time to the job
+void *componentHelper(void *args)
+{
+    ComponentJob *job = reinterpret_cast<ComponentJob *>(args);
+    componentWorker(job);
+    job->helperCpuMicros += static_cast<long long>(threadCpuMicros());
+    return nullptr;
+}
+
+// Takes up to wanted helper threads from spareComponentThreads, possibly none
+int claimComponentThreads(int wanted)
+{
+    int spare = spareComponentThreads.load();
+    int claimed = std::min(wanted, spare);
+    while (claimed > 0 && !spareComponentThreads.compare_exchange_weak(spare, spare - claimed))
+    {
+        claimed = std::min(wanted, spare);
+    }
+    return std::max(claimed, 0);
+}
+
+bool findVectorCover(const CsrGraph &graph, std::vector<int> &cover, int &lower, std::atomic<bool> &timedOut, double &helperCpuMicros)
+{
+    int v = graph.v;
+    const std::vector<std::pair<int, int>> &pairVector = graph.pairVector;
+    auto start_time = std::chrono::steady_clock::now();
+    lower = 0;
+    if (!splitIntoComponents)
+    {
+        lower = computeLowerBounds(graph).best();
+        std::unique_ptr<VertexCoverSat> sat = makeVertexCoverSat(v, pairVector);
+        if (satPhaseHints)
+        {
+            sat->setHint(cover);
+        }
+        WatchedSat watched(*sat, start_time + satTimeLimit, timedOut);
+        return findMinimumCover(*sat, satSearch, v, pairVector, [&]()
+                                { return satDeadlineReached(start_time, timedOut); },
+                                cover, lower);
+    }
+
+    // Components are independent SAT instances; workers pull them off a shared counter
+    std::vector<Component> components = splitComponents(v, pairVector);
+    ComponentJob job = {components, std::vector<std::vector<int>>(components.size()), std::vector<int>(components.size(), 0),
+                        {0}, start_time, timedOut, {false}, {0}};
+    // Each component starts from its share of the caller's cover
+    std::vector<std::pair<int, int>> place(v + 1, std::make_pair(-1, 0));
+    for (size_t i = 0; i < components.size(); ++i)
+    {
+        for (int vertex = 1; vertex <= components[i].v; ++vertex)
+        {
+            place[components[i].label[vertex]] = std::make_pair(static_cast<int>(i), vertex);
+        }
+    }
+    for (int vertex : cover)
+    {
+        if (place[vertex].first >= 0)
+        {
+            job.covers[place[vertex].first].push_back(place[vertex].second);
+        }
+    }
+    // The calling thread works too; helpers only run while spare cores are left
+    std::vector<pthread_t> threads(claimComponentThreads(static_cast<int>(components.size()) - 1));
+    for (pthread_t &thread : threads)
+    {
+        pthread_create(&thread, nullptr, componentHelper, &job);
+    }
+    componentWorker(&job);
+    for (pthread_t &thread : threads)
+    {
+        pthread_join(thread, nullptr);
+    }
+    spareComponentThreads += static_cast<int>(threads.size());
+    helperCpuMicros = job.helperCpuMicros;
+
+    // Covers and lower bounds of disjoint components add up, finished or not
+    cover.clear();
+    for (size_t i = 0; i < components.size(); ++i)
+    {
+        for (int vertex : job.covers[i])
+        {
+            cover.emplace_back(components[i].label[vertex]);
+        }
+        lower += job.lowers[i];
+    }
+    return !job.failed;
+}
+
+void findVectorCover_1(const CsrGraph &graph, std::vector<int> &cover)
+{
+    int v = graph.v;
+    const std::vector<int> &offsets = graph.offsets;
+    const std::vector<int> &neighbors = graph.neighbors;
+    // Working copy, lowered as the edges of taken vertices go away
+    std::vector<int> degree(graph.degree);
+
+    // Bucket queue: vertices of degree d form a doubly linked list from head[d]
+    int maxDegree = 0;
+    std::vector<int> head(v + 1, 0);
+    std::vector<int> next(v + 1, 0);
+    std::vector<int> prev(v + 1, 0);
+    auto unlink = [&](int vertex)
+    {
+        if (prev[vertex] != 0)
+        {
+            next[prev[vertex]] = next[vertex];
+        }
+        else
+        {
+            head[degree[vertex]] = next[vertex];
+        }
+        if (next[vertex] != 0)
+        {
+            prev[next[vertex]] = prev[vertex];
+        }
+    };
+    auto link = [&](int vertex)
+    {
+        prev[vertex] = 0;
+        next[vertex] = head[degree[vertex]];
+        if (next[vertex] != 0)
+        {
+            prev[next[vertex]] = vertex;
+        }
+        head[degree[vertex]] = vertex;
+    };
+    for (int i = v; i >= 1; --i)
+    {
+        if (degree[i] > 0)
+        {
+            link(i);
+            maxDegree = std::max(maxDegree, degree[i]);
+        }
+    }
+
+    // Take a vertex of maximum degree and drop its edges until none are left
+    std::vector<bool> taken(v + 1, false);
+    while (maxDegree > 0)
+    {
+        int vertex_max = head[maxDegree];
+        if (vertex_max == 0)
+        {
+            --maxDegree;
+            continue;
+        }
+        unlink(vertex_max);
+        taken[vertex_max] = true;
+        cover.emplace_back(vertex_max);
+
+        for (int i = offsets[vertex_max]; i < offsets[vertex_max + 1]; ++i)
+        {
+            int value = neighbors[i];
+            if (taken[value] || degree[value] == 0)
+            {
+                continue;
+            }
+            unlink(value);
+            if (--degree[value] > 0)
+            {
+                link(value);
+            }
+        }
+    }
+}
+
+void findVectorCover_2(const CsrGraph &graph, std::vector<int> &cover)
+{
+    // Taking the first uncovered edge in input order gives the same matching
+    // as repeatedly taking pairVector[0] and erasing every edge it touches
+    std::vector<bool> covered(graph.v + 1, false);
+    for (const auto &pair : graph.pairVector)
+    {
+        int first_vector = pair.first;
+        int second_vector = pair.second;
+        if (covered[first_vector] || covered[second_vector])
+        {
+            continue;
+        }
+        covered[first_vector] = true;
+        covered[second_vector] = true;
+
+        cover.emplace_back(first_vector);
+        cover.emplace_back(second_vector);
+    }
+}
@@ -0,0 +1,54 @@
+#ifndef VERTEX_COVER_H
+#define VERTEX_COVER_H
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "graph.h"
+#include "sat_vc.h"
+
+// The three vertex cover algorithms, shared by ece650-prj and vc-bench
+
+// CNF-SAT-VC strategy: keep one solver across all k, or rebuild it for every k
+enum SatMode
+{
+    SAT_INCREMENTAL,
+    SAT_REBUILD
+};
+
+// CNF-SAT-VC settings, fixed before the first graph is solved
+extern SatMode satMode;
+extern SatSearch satSearch;
+extern SatEncoding satEncoding;
+// Solve each connected component as its own SAT instance on a worker pool
+extern bool splitIntoComponents;
+// Seed the solver's phases and branching order with the starting cover
+extern bool satPhaseHints;
+// Position encoding: keep the vertices in increasing order along the positions
+extern bool satSymmetryBreaking;
+// Budget of one findVectorCover call; a watchdog interrupts the solver when it runs out
+extern const std::chrono::seconds satTimeLimit;
+
+// Sets satMode, satSearch or satEncoding from the value of --sat-mode,
+// --search or --encoding; prints an error and returns false for an unknown value
+bool parseSatOption(const char *option, const char *value);
+
+// CNF-SAT-VC: a minimum cover, or false once satTimeLimit passes (even in
+// the middle of a solve) or timedOut is set. cover must hold a cover of
+// graph on entry, normally the APPROX-VC-1 one, and the search starts
+// between it and the best lower bound of lower_bound.h. It is anytime: on
+// false, cover is the best cover found and lower a proven lower bound on
+// its minimum size. helperCpuMicros receives the CPU time of the extra
+// component worker threads.
+bool findVectorCover(const CsrGraph &graph, std::vector<int> &cover, int &lower, std::atomic<bool> &timedOut, double &helperCpuMicros);
+// APPROX-VC-1: repeatedly take a vertex of maximum degree
+void findVectorCover_1(const CsrGraph &graph, std::vector<int> &cover);
+// APPROX-VC-2: both endpoints of a maximal matching, in edge order
+void findVectorCover_2(const CsrGraph &graph, std::vector<int> &cover);
+
+std::unique_ptr<VertexCoverSat> makeVertexCoverSat(int v, const std::vector<std::pair<int, int>> &pairVector);
+bool satDeadlineReached(std::chrono::steady_clock::time_point start_time, std::atomic<bool> &timedOut);
+
+#endif
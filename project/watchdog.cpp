@@ -0,0 +1,102 @@
+#include "watchdog.h"
+#include <pthread.h>
+#include <algorithm>
+#include <ctime>
+#include <vector>
+
+namespace
+{
+struct Watch
+{
+    VertexCoverSat *sat;
+    std::chrono::steady_clock::time_point deadline;
+    std::atomic<bool> *timedOut;
+};
+
+// One thread serves every graph; it sleeps until the earliest deadline
+// and is woken whenever an earlier one is registered
+pthread_once_t started = PTHREAD_ONCE_INIT;
+pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+pthread_cond_t changed;
+std::vector<Watch> watches;
+
+void *watchdogThread(void *)
+{
+    pthread_mutex_lock(&mutex);
+    while (true)
+    {
+        auto now = std::chrono::steady_clock::now();
+        auto earliest = std::chrono::steady_clock::time_point::max();
+        for (size_t i = 0; i < watches.size();)
+        {
+            if (watches[i].deadline <= now)
+            {
+                // interrupt() runs under the mutex, so ~WatchedSat cannot free the engine meanwhile
+                watches[i].timedOut->store(true);
+                watches[i].sat->interrupt();
+                watches[i] = watches.back();
+                watches.pop_back();
+                continue;
+            }
+            earliest = std::min(earliest, watches[i].deadline);
+            ++i;
+        }
+
+        if (earliest == std::chrono::steady_clock::time_point::max())
+        {
+            pthread_cond_wait(&changed, &mutex);
+            continue;
+        }
+        // steady_clock is CLOCK_MONOTONIC, the clock the condition waits on
+        auto since = std::chrono::duration_cast<std::chrono::nanoseconds>(earliest.time_since_epoch()).count();
+        struct timespec wake;
+        wake.tv_sec = since / 1000000000;
+        wake.tv_nsec = since % 1000000000;
+        pthread_cond_timedwait(&changed, &mutex, &wake);
+    }
+    return nullptr;
+}
+
+void startWatchdog()
+{
+    pthread_condattr_t attributes;
+    pthread_condattr_init(&attributes);
+    pthread_condattr_setclock(&attributes, CLOCK_MONOTONIC);
+    pthread_cond_init(&changed, &attributes);
+    pthread_condattr_destroy(&attributes);
+
+    pthread_t thread;
+    pthread_create(&thread, nullptr, watchdogThread, nullptr);
+    pthread_detach(thread);
+}
+}
+
+WatchedSat::WatchedSat(VertexCoverSat &sat, std::chrono::steady_clock::time_point deadline, std::atomic<bool> &timedOut)
+    : sat(sat)
+{
+    pthread_once(&started, startWatchdog);
+    pthread_mutex_lock(&mutex);
+    bool earliest = std::all_of(watches.begin(), watches.end(), [&](const Watch &watch)
+                                { return deadline < watch.deadline; });
+    watches.push_back({&sat, deadline, &timedOut});
+    if (earliest)
+    {
+        pthread_cond_signal(&changed);
+    }
+    pthread_mutex_unlock(&mutex);
+}
+
+WatchedSat::~WatchedSat()
+{
+    pthread_mutex_lock(&mutex);
+    for (size_t i = 0; i < watches.size(); ++i)
+    {
+        if (watches[i].sat == &sat)
+        {
+            watches[i] = watches.back();
+            watches.pop_back();
+            break;
+        }
+    }
+    pthread_mutex_unlock(&mutex);
+}
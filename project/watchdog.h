@@ -0,0 +1,22 @@
+#ifndef WATCHDOG_H
+#define WATCHDOG_H
+
+#include <atomic>
+#include <chrono>
+#include "sat_vc.h"
+
+// Keeps sat registered with a shared background thread for its lifetime.
+// Once deadline passes the thread sets timedOut and interrupts sat, so a
+// solve in progress gives up within one solver decision instead of running
+// on until the next k.
+class WatchedSat
+{
+public:
+    WatchedSat(VertexCoverSat &sat, std::chrono::steady_clock::time_point deadline, std::atomic<bool> &timedOut);
+    ~WatchedSat();
+
+private:
+    VertexCoverSat &sat;
+};
+
+#endif